@@ -0,0 +1,303 @@
+#pragma once
+
+// ȵĲ׮
+// ĬϲãδDSE_INSTRUMENTATIONʱDSE_INSTRUMENT_*չΪգ׮Ĵδ׮ʱȫͬ
+// ĿԤмDSE_INSTRUMENTATIONڰļǰ壩ã
+// úÿ׮ĲӵһrelaxedԭӲۼӣ߳Ҳʹá
+// ͬһƵļڽֻһ飬ʵĿñļ
+//
+// ÷
+// DSE_INSTRUMENT_SCOPE()ںͷʹãôһ뿪ʱۼӺʱ
+// ݹ麯ӦʹãظʱӦⲿʹ
+// DSE_INSTRUMENT_COUNTERS()ֻȡʱݹ麯ڲʵֺʹ
+// DSE_INSTRUMENT_ADD(, )ۼӼ֮һ֮ʹ
+// DSE_INSTRUMENT_PEAK(, ǰֵ)Եǰֵ·ֵ
+// DSE_INSTRUMENT_DEPTH()ڵݹ麯ͷʹãʱȼһPEAK_DEPTH뿪ʱȼһ
+
+#include <ostream>
+#include <string>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+using std::ostream;
+using std::string;
+using std::map;
+using std::unique_ptr;
+using std::make_unique;
+using std::mutex;
+using std::lock_guard;
+using std::atomic;
+using std::array;
+using std::uint64_t;
+
+enum class InstrumentationCounter
+{
+	// õĴDSE_INSTRUMENT_SCOPEۼ
+	CALLS,
+	// ۼƺʱDSE_INSTRUMENT_SCOPEۼ
+	ELAPSED_NANOSECONDS,
+	VERTEXES_VISITED,
+	EDGES_SCANNED,
+	NODES_VISITED,
+	COMPARES,
+	// 㡢߳ءڽӾȽ洢Ķѷ
+	ALLOCATIONS,
+	// ջлݹķֵ
+	PEAK_DEPTH,
+	COUNTER_COUNT
+};
+
+// һȫ
+class OperationCounters final
+{
+private:
+	static constexpr size_t kCounterCount =
+		static_cast<size_t>(InstrumentationCounter::COUNTER_COUNT);
+
+	array<atomic<uint64_t>, kCounterCount> values_{};
+	// DSE_INSTRUMENT_DEPTHʹõĵǰݹ
+	atomic<uint64_t> current_depth_ = 0;
+
+public:
+	OperationCounters() = default;
+	~OperationCounters() = default;
+
+	OperationCounters(const OperationCounters&) = delete;
+	OperationCounters& operator=(const OperationCounters&) = delete;
+
+	void Add(InstrumentationCounter counter, uint64_t value)
+	{
+		values_[static_cast<size_t>(counter)].fetch_add(value, std::memory_order_relaxed);
+	}
+
+	void UpdatePeak(InstrumentationCounter counter, uint64_t value)
+	{
+		atomic<uint64_t>& peak = values_[static_cast<size_t>(counter)];
+		uint64_t current_peak = peak.load(std::memory_order_relaxed);
+
+		while (value > current_peak
+			&& !peak.compare_exchange_weak(current_peak, value, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	uint64_t Get(InstrumentationCounter counter) const
+	{
+		return values_[static_cast<size_t>(counter)].load(std::memory_order_relaxed);
+	}
+
+	void EnterDepth()
+	{
+		UpdatePeak(InstrumentationCounter::PEAK_DEPTH,
+			current_depth_.fetch_add(1, std::memory_order_relaxed) + 1);
+	}
+
+	void LeaveDepth()
+	{
+		current_depth_.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	void Reset()
+	{
+		for (auto& i : values_)
+		{
+			i.store(0, std::memory_order_relaxed);
+		}
+
+		current_depth_.store(0, std::memory_order_relaxed);
+	}
+};
+
+// ȫֵǼǱ
+class Instrumentation final
+{
+private:
+	static mutex& GetMutex();
+	static map<string, unique_ptr<OperationCounters>>& GetRegistry();
+
+	// ̬ԱGetCounterNameȡJSONеļ
+	static const char* GetCounterName(InstrumentationCounter counter);
+
+public:
+	// ̬ԱGetOperationCountersȡƵĲļʱ
+	// صڽ̽ǰʼЧ˲׮ÿ׮ֻһ
+	static OperationCounters& GetOperationCounters(const string& operation_name);
+
+	// ̬ԱResetм
+	static void Reset();
+
+	// ̬ԱDumpJsonJSONʽвļ
+	// {"":{"calls":...,"elapsed_nanoseconds":...,...},...}
+	static void DumpJson(ostream& output_stream);
+};
+
+// ʱ򣬹ʱôһʱۼӺʱ
+class InstrumentationScope final
+{
+private:
+	OperationCounters& counters_;
+	std::chrono::steady_clock::time_point begin_time_;
+
+public:
+	explicit InstrumentationScope(OperationCounters& counters) :
+		counters_(counters), begin_time_(std::chrono::steady_clock::now())
+	{
+		counters_.Add(InstrumentationCounter::CALLS, 1);
+	}
+
+	~InstrumentationScope()
+	{
+		counters_.Add(InstrumentationCounter::ELAPSED_NANOSECONDS,
+			std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now() - begin_time_).count());
+	}
+
+	InstrumentationScope(const InstrumentationScope&) = delete;
+	InstrumentationScope& operator=(const InstrumentationScope&) = delete;
+};
+
+// 򣬹ʱȼһʱȼһ
+class InstrumentationDepth final
+{
+private:
+	OperationCounters& counters_;
+
+public:
+	explicit InstrumentationDepth(OperationCounters& counters) :counters_(counters)
+	{
+		counters_.EnterDepth();
+	}
+
+	~InstrumentationDepth()
+	{
+		counters_.LeaveDepth();
+	}
+
+	InstrumentationDepth(const InstrumentationDepth&) = delete;
+	InstrumentationDepth& operator=(const InstrumentationDepth&) = delete;
+};
+
+inline mutex& Instrumentation::GetMutex()
+{
+	static mutex registry_mutex;
+	return registry_mutex;
+}
+
+inline map<string, unique_ptr<OperationCounters>>& Instrumentation::GetRegistry()
+{
+	static map<string, unique_ptr<OperationCounters>> registry;
+	return registry;
+}
+
+inline const char* Instrumentation::GetCounterName(InstrumentationCounter counter)
+{
+	switch (counter)
+	{
+		case InstrumentationCounter::CALLS:
+			return "calls";
+		case InstrumentationCounter::ELAPSED_NANOSECONDS:
+			return "elapsed_nanoseconds";
+		case InstrumentationCounter::VERTEXES_VISITED:
+			return "vertexes_visited";
+		case InstrumentationCounter::EDGES_SCANNED:
+			return "edges_scanned";
+		case InstrumentationCounter::NODES_VISITED:
+			return "nodes_visited";
+		case InstrumentationCounter::COMPARES:
+			return "compares";
+		case InstrumentationCounter::ALLOCATIONS:
+			return "allocations";
+		case InstrumentationCounter::PEAK_DEPTH:
+			return "peak_depth";
+		default:
+			return "unknown";
+	}
+}
+
+inline OperationCounters& Instrumentation::GetOperationCounters(const string& operation_name)
+{
+	lock_guard<mutex> lock(GetMutex());
+
+	unique_ptr<OperationCounters>& counters = GetRegistry()[operation_name];
+
+	if (!counters)
+	{
+		counters = make_unique<OperationCounters>();
+	}
+
+	return *counters;
+}
+
+inline void Instrumentation::Reset()
+{
+	lock_guard<mutex> lock(GetMutex());
+
+	for (auto& i : GetRegistry())
+	{
+		i.second->Reset();
+	}
+}
+
+inline void Instrumentation::DumpJson(ostream& output_stream)
+{
+	lock_guard<mutex> lock(GetMutex());
+
+	output_stream << '{';
+
+	bool is_first_operation = true;
+
+	for (auto& i : GetRegistry())
+	{
+		if (!is_first_operation)
+		{
+			output_stream << ',';
+		}
+
+		is_first_operation = false;
+
+		// ɲ׮Ҫתַ
+		output_stream << '"' << i.first << "\":{";
+
+		for (size_t j = 0; j < static_cast<size_t>(InstrumentationCounter::COUNTER_COUNT); j++)
+		{
+			InstrumentationCounter counter = static_cast<InstrumentationCounter>(j);
+
+			if (j != 0)
+			{
+				output_stream << ',';
+			}
+
+			output_stream << '"' << GetCounterName(counter) << "\":" << i.second->Get(counter);
+		}
+
+		output_stream << '}';
+	}
+
+	output_stream << '}';
+}
+
+#ifdef DSE_INSTRUMENTATION
+#define DSE_INSTRUMENT_COUNTERS(operation_name) \
+	static OperationCounters& dse_instrumentation_counters = \
+		Instrumentation::GetOperationCounters(operation_name)
+#define DSE_INSTRUMENT_SCOPE(operation_name) \
+	DSE_INSTRUMENT_COUNTERS(operation_name); \
+	InstrumentationScope dse_instrumentation_scope(dse_instrumentation_counters)
+#define DSE_INSTRUMENT_ADD(counter, value) \
+	dse_instrumentation_counters.Add(InstrumentationCounter::counter, (value))
+#define DSE_INSTRUMENT_PEAK(counter, value) \
+	dse_instrumentation_counters.UpdatePeak(InstrumentationCounter::counter, (value))
+#define DSE_INSTRUMENT_DEPTH() \
+	InstrumentationDepth dse_instrumentation_depth(dse_instrumentation_counters)
+#else
+#define DSE_INSTRUMENT_COUNTERS(operation_name)
+#define DSE_INSTRUMENT_SCOPE(operation_name)
+#define DSE_INSTRUMENT_ADD(counter, value)
+#define DSE_INSTRUMENT_PEAK(counter, value)
+#define DSE_INSTRUMENT_DEPTH()
+#endif
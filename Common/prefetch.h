@@ -0,0 +1,21 @@
+#pragma once
+
+// Ԥȡ
+// PrefetchForRead(address)ʾaddressڻǰ뻺棬ı壻
+// ԤȡָַЧ쳣÷Ӧ֤addressɺϷָõ
+// ʵĿñļ
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+inline void PrefetchForRead(const void* address)
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	_mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#elif defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(address, 0, 3);
+#else
+	(void)address;
+#endif
+}
@@ -2,6 +2,7 @@
 #include <vector>
 
 #include "binary_tree_presenter.h"
+#include "../Common/instrumentation.h"
 
 using std::cin;
 using std::cout;
@@ -68,5 +69,12 @@ int main()
 	cout << std::boolalpha << presenter.IsComplete() << std::noboolalpha;
 	cout << endl;
 
+	// 启用插桩（定义DSE_INSTRUMENTATION）时，以JSON形式输出各热点操作的计数器
+#ifdef DSE_INSTRUMENTATION
+	cout << "[INSTRUMENTATION]" << endl;
+	Instrumentation::DumpJson(cout);
+	cout << endl;
+#endif
+
 	return 0;
 }
\ No newline at end of file
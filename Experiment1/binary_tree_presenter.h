@@ -6,6 +6,8 @@
 #include <stack>
 #include <memory>
 
+#include "../Common/instrumentation.h"
+
 using std::cin;
 using std::cout;
 using std::endl;
@@ -93,6 +95,8 @@ private:
 template <typename T>
 void BinaryTreePresenter<T>::CreateTree(const vector<T>& node_values)
 {
+	DSE_INSTRUMENT_SCOPE("BinaryTreePresenter::CreateTree");
+
 	// иڵΪգֱroot_ԱΪָ
 	if (node_values[0] == empty_node_value_)
 	{
@@ -103,6 +107,7 @@ void BinaryTreePresenter<T>::CreateTree(const vector<T>& node_values)
 	// ڲ
 
 	TreeNodePtr root = make_shared<TreeNode>(node_values[0]);
+	DSE_INSTRUMENT_ADD(ALLOCATIONS, 1);
 
 	// ʽ֯ģ˴˶Ҳʽ洢Ԫأ
 	// ѭУԿյĶӽ㣬Թӣһָռλ
@@ -124,6 +129,7 @@ void BinaryTreePresenter<T>::CreateTree(const vector<T>& node_values)
 		{
 			current_node->left_child =
 				make_shared<TreeNode>(node_values[current_index]);
+			DSE_INSTRUMENT_ADD(ALLOCATIONS, 1);
 			level_order_queue.push(current_node->left_child);
 		}
 		// ָֻ
@@ -139,6 +145,7 @@ void BinaryTreePresenter<T>::CreateTree(const vector<T>& node_values)
 		{
 			current_node->right_child =
 				make_shared<TreeNode>(node_values[current_index]);
+			DSE_INSTRUMENT_ADD(ALLOCATIONS, 1);
 			level_order_queue.push(current_node->right_child);
 		}
 		// ָֻ
@@ -207,6 +214,8 @@ void BinaryTreePresenter<T>::PrintTree() const
 template<typename T>
 void BinaryTreePresenter<T>::PreOrderTraversalRecursive() const
 {
+	DSE_INSTRUMENT_SCOPE("BinaryTreePresenter::PreOrderTraversalRecursive");
+
 	PreOrderTraversalRecursiveImp(root_);
 }
 
@@ -214,6 +223,8 @@ void BinaryTreePresenter<T>::PreOrderTraversalRecursive() const
 template<typename T>
 void BinaryTreePresenter<T>::PreOrderTraversalIterative() const
 {
+	DSE_INSTRUMENT_SCOPE("BinaryTreePresenter::PreOrderTraversalIterative");
+
 	stack<TreeNodePtr> preorder_stack;
 
 	TreeNodePtr current_node = root_;
@@ -222,8 +233,10 @@ void BinaryTreePresenter<T>::PreOrderTraversalIterative() const
 	{
 		if (current_node)
 		{
+			DSE_INSTRUMENT_ADD(NODES_VISITED, 1);
 			cout << current_node->value << ' ';
 			preorder_stack.push(current_node);
+			DSE_INSTRUMENT_PEAK(PEAK_DEPTH, preorder_stack.size());
 			current_node = current_node->left_child;
 		}
 		else
@@ -238,6 +251,8 @@ void BinaryTreePresenter<T>::PreOrderTraversalIterative() const
 template<typename T>
 void BinaryTreePresenter<T>::InOrderTraversalRecursive() const
 {
+	DSE_INSTRUMENT_SCOPE("BinaryTreePresenter::InOrderTraversalRecursive");
+
 	InOrderTraversalRecursiveImp(root_);
 }
 
@@ -245,6 +260,8 @@ void BinaryTreePresenter<T>::InOrderTraversalRecursive() const
 template<typename T>
 void BinaryTreePresenter<T>::InOrderTraversalIterative() const
 {
+	DSE_INSTRUMENT_SCOPE("BinaryTreePresenter::InOrderTraversalIterative");
+
 	stack<TreeNodePtr> inorder_stack;
 
 	TreeNodePtr current_node = root_;
@@ -254,12 +271,14 @@ void BinaryTreePresenter<T>::InOrderTraversalIterative() const
 		if (current_node)
 		{
 			inorder_stack.push(current_node);
+			DSE_INSTRUMENT_PEAK(PEAK_DEPTH, inorder_stack.size());
 			current_node = current_node->left_child;
 		}
 		else
 		{
 			current_node = inorder_stack.top();
 			inorder_stack.pop();
+			DSE_INSTRUMENT_ADD(NODES_VISITED, 1);
 			cout << current_node->value << ' ';
 			current_node = current_node->right_child;
 		}
@@ -270,6 +289,8 @@ void BinaryTreePresenter<T>::InOrderTraversalIterative() const
 template<typename T>
 void BinaryTreePresenter<T>::PostOrderTraversalRecursive() const
 {
+	DSE_INSTRUMENT_SCOPE("BinaryTreePresenter::PostOrderTraversalRecursive");
+
 	PostOrderTraversalRecursiveImp(root_);
 }
 
@@ -277,6 +298,8 @@ void BinaryTreePresenter<T>::PostOrderTraversalRecursive() const
 template<typename T>
 void BinaryTreePresenter<T>::PostOrderTraversalIterative() const
 {
+	DSE_INSTRUMENT_SCOPE("BinaryTreePresenter::PostOrderTraversalIterative");
+
 	stack<TreeNodePtr> postorder_stack;
 
 	TreeNodePtr current_node = root_;
@@ -288,6 +311,7 @@ void BinaryTreePresenter<T>::PostOrderTraversalIterative() const
 		if (current_node)
 		{
 			postorder_stack.push(current_node);
+			DSE_INSTRUMENT_PEAK(PEAK_DEPTH, postorder_stack.size());
 			current_node = current_node->left_child;
 		}
 		else
@@ -301,6 +325,7 @@ void BinaryTreePresenter<T>::PostOrderTraversalIterative() const
 			}
 			else
 			{
+				DSE_INSTRUMENT_ADD(NODES_VISITED, 1);
 				cout << parent_node->value << ' ';
 				previous_visited_node = parent_node;
 				postorder_stack.pop();
@@ -313,6 +338,8 @@ void BinaryTreePresenter<T>::PostOrderTraversalIterative() const
 template<typename T>
 void BinaryTreePresenter<T>::LevelOrderTraversal() const
 {
+	DSE_INSTRUMENT_SCOPE("BinaryTreePresenter::LevelOrderTraversal");
+
 	if (!root_)
 	{
 		return;
@@ -327,6 +354,8 @@ void BinaryTreePresenter<T>::LevelOrderTraversal() const
 		TreeNodePtr current_node = level_order_queue.front();
 		level_order_queue.pop();
 
+		DSE_INSTRUMENT_ADD(NODES_VISITED, 1);
+
 		cout << current_node->value << ' ';
 
 		if (current_node->left_child)
@@ -338,6 +367,8 @@ void BinaryTreePresenter<T>::LevelOrderTraversal() const
 		{
 			level_order_queue.push(current_node->right_child);
 		}
+
+		DSE_INSTRUMENT_PEAK(PEAK_DEPTH, level_order_queue.size());
 	}
 }
 
@@ -414,6 +445,10 @@ PreOrderTraversalRecursiveImp(const TreeNodePtr& node) const
 {
 	if (node)
 	{
+		DSE_INSTRUMENT_COUNTERS("BinaryTreePresenter::PreOrderTraversalRecursive");
+		DSE_INSTRUMENT_DEPTH();
+		DSE_INSTRUMENT_ADD(NODES_VISITED, 1);
+
 		cout << node->value << ' ';
 
 		PreOrderTraversalRecursiveImp(node->left_child);
@@ -428,6 +463,10 @@ InOrderTraversalRecursiveImp(const TreeNodePtr& node) const
 {
 	if (node)
 	{
+		DSE_INSTRUMENT_COUNTERS("BinaryTreePresenter::InOrderTraversalRecursive");
+		DSE_INSTRUMENT_DEPTH();
+		DSE_INSTRUMENT_ADD(NODES_VISITED, 1);
+
 		InOrderTraversalRecursiveImp(node->left_child);
 
 		cout << node->value << ' ';
@@ -443,6 +482,10 @@ PostOrderTraversalRecursiveImp(const TreeNodePtr& node) const
 {
 	if (node)
 	{
+		DSE_INSTRUMENT_COUNTERS("BinaryTreePresenter::PostOrderTraversalRecursive");
+		DSE_INSTRUMENT_DEPTH();
+		DSE_INSTRUMENT_ADD(NODES_VISITED, 1);
+
 		PostOrderTraversalRecursiveImp(node->left_child);
 		PostOrderTraversalRecursiveImp(node->right_child);
 
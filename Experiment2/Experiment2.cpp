@@ -1,17 +1,28 @@
 ﻿#include <iostream>
 #include <format>
-#include <fstream>
 #include <tuple>
+#include <cstdlib>
 
 #include "adjacency_list_graph.h"
 #include "adjacency_matrix_graph.h"
+#include "csr_graph.h"
+#include "direction_optimizing_bfs.h"
+#include "parallel_bfs.h"
+#include "binary_graph_file.h"
+#include "graph_text_parser.h"
+#include "shortest_paths.h"
+#include "minimum_spanning_tree.h"
+#include "strongly_connected_components.h"
+#include "topological_sort.h"
+#include "vertex_reordering.h"
+#include "graph_generators.h"
+#include "graph_benchmark.h"
+#include "../Common/instrumentation.h"
 
 using std::cin;
 using std::cout;
 using std::endl;
 
-using std::ifstream;
-
 using std::tuple;
 using std::make_tuple;
 
@@ -23,18 +34,7 @@ class GraphPresenter final
 private:
 	AdjacencyListGraph<TE, TV> graph_adj_list;
 	AdjacencyMatrixGraph<TE, TV> graph_adj_matrix;
-
-	// 成员函数BuildAdjacencyListGraphFromStream:
-	// 从给定输入流读取图的邻接表表示数据，
-	// 并调用graph_adj_list对象的BuildGraph成员函数建图
-	// 流读取到的第一个数据是表示是否是有向图的一个数字，
-	// 第二个数据是表图顶点数量的一个正整数vertex_count，
-	// 第三个数据是表示图边数量的正整数edge_count，
-	// 后面是vertex_count个TV类型的顶点数据域数据，
-	// 此后是edge_count对的(边起点下标-边终点下标-边权)数据。
-	tuple<vector<TV>,
-		const vector<vector<pair<size_t, TE>>>,
-		size_t> GetAdjacencyListGraphDataFromStream(std::istream& input_stream);
+	CSRGraph<TE, TV> graph_csr;
 
 public:
 	GraphPresenter() = default;
@@ -45,78 +45,37 @@ public:
 };
 
 template<typename TE, typename TV>
-tuple<vector<TV>,
-	const vector<vector<pair<size_t, TE>>>,
-	size_t> GraphPresenter<TE, TV>::
-	GetAdjacencyListGraphDataFromStream(std::istream& input_stream)
+void GraphPresenter<TE, TV>::BeginPresentation()
 {
-	vector<TV> vex_data;
-	vector<vector<pair<size_t, TE>>> vex_adj_data;
-
-	bool is_directed_graph = false;
-	size_t vertex_count = 0;
-	size_t edge_count = 0;
-	input_stream >> is_directed_graph >> vertex_count >> edge_count;
+	string file_name;
 
-	vex_adj_data.resize(vertex_count);
+	cin >> file_name;
 
-	for (size_t i = 0; i < vertex_count; i++)
-	{
-		TV current_vertex_data;
-		input_stream >> current_vertex_data;
+	ThreadPool thread_pool;
 
-		vex_data.emplace_back(std::move(current_vertex_data));
-	}
+	bool is_directed_graph = false;
 
-	for (size_t i = 0; i < edge_count; i++)
+	// 二进制图文件(.gbin)直接映射为CSR图，无需解析
+	if (file_name.ends_with(".gbin"))
 	{
-		size_t current_vertex_begin_index = 0;
-		size_t current_vertex_end_index = 0;
-		TE current_cost;
-
-		input_stream >> current_vertex_begin_index
-			>> current_vertex_end_index
-			>> current_cost;
-
-		vex_adj_data[current_vertex_begin_index].emplace_back(
-			current_vertex_end_index, current_cost);
-
-		if (!is_directed_graph)
+		if (!BinaryGraphFile::Load(file_name, graph_csr, is_directed_graph))
 		{
-			vex_adj_data[current_vertex_end_index].emplace_back(
-				current_vertex_begin_index, current_cost);
+			cout << "BINARY GRAPH FILE COULDN'T BE LOADED. PRESENTATION EXIT." << endl;
+			return;
 		}
 	}
-
-	return make_tuple(
-		std::move(vex_data),
-		std::move(vex_adj_data),
-		edge_count);
-}
-
-template<typename TE, typename TV>
-void GraphPresenter<TE, TV>::BeginPresentation()
-{
-	// BuildAdjacencyListGraphFromStream(cin);
-
-	string file_name;
-
-	cin >> file_name;
-
-	ifstream ifs(file_name, std::ios::in);
-
-	if (!ifs.is_open())
+	else
 	{
-		cout << "DATA FILE COULDN'T BE OPENED. PRESENTATION EXIT." << endl;
-		return;
+		if (!GraphTextParser::Parse(file_name, graph_csr, is_directed_graph, &thread_pool))
+		{
+			cout << "DATA FILE COULDN'T BE OPENED OR PARSED. PRESENTATION EXIT." << endl;
+			return;
+		}
 	}
 
-	auto adj_list_graph_data_from_stream =
-		GetAdjacencyListGraphDataFromStream(ifs);
-
-	ifs.close();
+	graph_adj_list.BuildGraph(graph_csr.GetAdjacencyListGraphData());
 
-	graph_adj_list.BuildGraph(adj_list_graph_data_from_stream);
+	cout << "<CONVERTED FROM CSR GRAPH TO ADJ-LIST GRAPH.>" << endl << endl;
 
 	if (graph_adj_list.vertex_count == 0)
 	{
@@ -130,12 +89,93 @@ void GraphPresenter<TE, TV>::BeginPresentation()
 
 	graph_adj_list.DFS(true);
 
+	graph_adj_list.DFSExplicitStack();
+
 	graph_adj_list.BFS();
 
+	vector<size_t> component_labels = graph_adj_list.ConnectedComponents(&thread_pool);
+
+	cout << "NUMBER OF CONNECTED COMPONENT(s):"
+		<< ComponentLabeler::GetComponentCount(component_labels) << endl << endl;
+
+	StronglyConnectedComponents strongly_connected_components(graph_adj_list);
+
+	StronglyConnectedComponentResults::DisplayStronglyConnectedComponentResults(
+		strongly_connected_components.Tarjan(), graph_adj_list);
+
+	StronglyConnectedComponentResults::DisplayStronglyConnectedComponentResults(
+		strongly_connected_components.Kosaraju(), graph_adj_list);
+
+	StronglyConnectedComponentResults::DisplayStronglyConnectedComponentResults(
+		strongly_connected_components.ForwardBackward(thread_pool), graph_adj_list);
+
+	TopologicalOrderResults::DisplayTopologicalOrderResults(
+		TopologicalSorter::Kahn(graph_adj_list), graph_adj_list);
+
+	DirectionOptimizingBFS<TE> direction_optimizing_bfs(graph_adj_list);
+
+	TraversalResults<TE, TV> direction_optimizing_bfs_results(
+		graph_adj_list.vertex_count,
+		TraversalResultsType::BFS_DIRECTION_OPTIMIZING);
+
+	direction_optimizing_bfs.BFS(direction_optimizing_bfs_results);
+
+	TraversalResults<TE, TV>::DisplayTraversalResults(
+		direction_optimizing_bfs_results, graph_adj_list);
+
+	ParallelBFS<TE> parallel_bfs(graph_adj_list, thread_pool);
+
+	TraversalResults<TE, TV> parallel_bfs_results(
+		graph_adj_list.vertex_count, TraversalResultsType::BFS_PARALLEL);
+
+	parallel_bfs.BFS(parallel_bfs_results, true);
+
+	TraversalResults<TE, TV>::DisplayTraversalResults(
+		parallel_bfs_results, graph_adj_list);
+
+	for (auto i : {
+		VertexOrdering::REVERSE_CUTHILL_MCKEE,
+		VertexOrdering::DEGREE_DESCENDING,
+		VertexOrdering::BFS })
+	{
+		VertexPermutation::DisplayVertexPermutation(
+			VertexReordering::ComputePermutation(graph_adj_list, i), graph_adj_list);
+	}
+
+	// 在按逆Cuthill-McKee序重排的CSR图上遍历，结果换算回原下标后以原图展示
+	VertexPermutation rcm_permutation = VertexReordering::ComputePermutation(
+		graph_adj_list, VertexOrdering::REVERSE_CUTHILL_MCKEE);
+
+	CSRGraph<TE, TV> reordered_graph_csr;
+
+	reordered_graph_csr.BuildGraph(VertexReordering::Apply(graph_adj_list, rcm_permutation));
+
+	TraversalResults<TE, TV> reordered_bfs_results(
+		graph_adj_list.vertex_count, TraversalResultsType::BFS_REORDERED);
+
+	OriginalIndexVisitor<TE> original_index_visitor(reordered_bfs_results, rcm_permutation);
+
+	reordered_graph_csr.BFS(original_index_visitor);
+
+	TraversalResults<TE, TV>::DisplayTraversalResults(
+		reordered_bfs_results, graph_adj_list);
+
+	ShortestPaths<TE> shortest_paths(graph_adj_list);
+
+	ShortestPathResults<TE>::DisplayShortestPathResults(
+		shortest_paths.Dijkstra(0), graph_adj_list);
+
+	ShortestPathResults<TE>::DisplayShortestPathResults(
+		shortest_paths.DeltaStepping(0, shortest_paths.GetDefaultDelta(), thread_pool),
+		graph_adj_list);
+
 	auto adj_matrix_graph_data =
-		graph_adj_list.GetAdjacencyMatrixGraphData(0x3F3F3F3F);
+		graph_adj_list.GetAdjacencyMatrixGraphData(0x3F3F3F3F, &thread_pool);
+
+	cout << "<CONVERTED FROM ADJ-LIST GRAPH TO ADJ-MATRIX GRAPH.>" << endl << endl;
 
-	graph_adj_matrix.BuildGraph(adj_matrix_graph_data);
+	graph_adj_matrix.BuildGraph(
+		adj_matrix_graph_data, MatrixStorageMode::COST_MATRIX_WITH_BITSET);
 
 	graph_adj_matrix.DisplayGraph();
 
@@ -143,22 +183,131 @@ void GraphPresenter<TE, TV>::BeginPresentation()
 
 	graph_adj_matrix.DFS(true);
 
+	graph_adj_matrix.DFSExplicitStack();
+
 	graph_adj_matrix.BFS();
 
+	AllPairsShortestPathResults<TE>::DisplayAllPairsShortestPathResults(
+		graph_adj_matrix.AllPairsShortestPaths(&thread_pool));
+
+	MinimumSpanningTree<TE> minimum_spanning_tree(graph_adj_matrix);
+
+	MinimumSpanningTreeResults<TE>::DisplayMinimumSpanningTreeResults(
+		minimum_spanning_tree.Kruskal(&thread_pool), graph_adj_matrix);
+
+	MinimumSpanningTreeResults<TE>::DisplayMinimumSpanningTreeResults(
+		minimum_spanning_tree.Prim(), graph_adj_matrix);
+
+	MinimumSpanningTreeResults<TE>::DisplayMinimumSpanningTreeResults(
+		minimum_spanning_tree.Boruvka(thread_pool), graph_adj_matrix);
+
 	auto adj_list_graph_data =
-		graph_adj_matrix.GetAdjacencyListGraphData();
+		graph_adj_matrix.GetAdjacencyListGraphData(&thread_pool);
+
+	cout << "<CONVERTED FROM ADJ-MATRIX GRAPH TO ADJ-LIST GRAPH.>" << endl << endl;
 
 	graph_adj_list.BuildGraph(adj_list_graph_data);
 
 	graph_adj_list.DisplayGraph();
+
+	graph_csr.BuildGraph(adj_list_graph_data);
+
+	graph_csr.DisplayGraph();
+
+	graph_csr.DFS(false);
+
+	graph_csr.DFS(true);
+
+	graph_csr.DFSExplicitStack();
+
+	graph_csr.BFS();
+
+	graph_adj_matrix.BuildGraph(
+		graph_csr.GetAdjacencyMatrixGraphData(0x3F3F3F3F, &thread_pool));
+
+	cout << "<CONVERTED FROM CSR GRAPH TO ADJ-MATRIX GRAPH.>" << endl << endl;
+
+	graph_adj_matrix.DisplayGraph();
+}
+
+// 启用插桩（定义DSE_INSTRUMENTATION）时，以JSON形式输出各热点操作的计数器
+void DumpInstrumentation()
+{
+#ifdef DSE_INSTRUMENTATION
+	cout << "[INSTRUMENTATION]" << endl;
+	Instrumentation::DumpJson(cout);
+	cout << endl << endl;
+#endif
 }
 
-int main()
+// 以"--convert 文本图文件 二进制图文件"参数启动时，仅将文本格式的图转换为二进制图文件
+int main(int argc, char* argv[])
 {
+	if (argc == 4 && string(argv[1]) == "--convert")
+	{
+		ThreadPool thread_pool;
+
+		if (!BinaryGraphFile::ConvertFromText<int, char>(argv[2], argv[3], &thread_pool))
+		{
+			cout << "GRAPH FILE CONVERSION FAILED." << endl;
+			return 1;
+		}
+
+		cout << "GRAPH FILE CONVERTED." << endl;
+		return 0;
+	}
+
+	// 以"--benchmark 图类型 参数1 参数2 [重复次数]"参数启动时，在合成图上运行基准测试：
+	// rmat 规模 边数因子：2^规模个顶点、边数因子 * 2^规模条边的R-MAT图；
+	// er 顶点数 边数：Erdos-Renyi随机图；grid 行数 列数：二维网格图。生成的图均为无向图
+	if ((argc == 5 || argc == 6) && string(argv[1]) == "--benchmark")
+	{
+		constexpr uint64_t kBenchmarkSeed = 20211024;
+
+		string generator_name = argv[2];
+		size_t first_parameter = std::strtoull(argv[3], nullptr, 10);
+		size_t second_parameter = std::strtoull(argv[4], nullptr, 10);
+		size_t repetition_count = argc == 6 ? std::strtoull(argv[5], nullptr, 10) : 5;
+
+		tuple<vector<char>, vector<vector<pair<size_t, int>>>, size_t> graph_data;
+
+		if (generator_name == "rmat")
+		{
+			graph_data = GraphGenerator::RMAT<int, char>(
+				first_parameter, second_parameter, false, kBenchmarkSeed);
+		}
+		else if (generator_name == "er")
+		{
+			graph_data = GraphGenerator::ErdosRenyi<int, char>(
+				first_parameter, second_parameter, false, kBenchmarkSeed);
+		}
+		else if (generator_name == "grid")
+		{
+			graph_data = GraphGenerator::Grid<int, char>(
+				first_parameter, second_parameter, false, kBenchmarkSeed);
+		}
+		else
+		{
+			cout << "UNKNOWN GRAPH GENERATOR. USE rmat, er OR grid." << endl;
+			return 1;
+		}
+
+		GraphBenchmark<int, char> benchmark(repetition_count);
+
+		benchmark.Run(format("{0}({1},{2})",
+			generator_name, first_parameter, second_parameter), graph_data);
+
+		DumpInstrumentation();
+
+		return 0;
+	}
+
 	GraphPresenter presenter;
 
 	presenter.BeginPresentation();
 
+	DumpInstrumentation();
+
 	return 0;
 }
 
@@ -1,38 +1,47 @@
 #pragma once
 
 #include <vector>
+#include <tuple>
+#include <utility>
 
 #include "traversal_results.h"
 
 using std::vector;
+using std::tuple;
+using std::get;
+using std::pair;
+
+class ThreadPool;
 
 // AbstractGraphͼӿ
 // ģTE: Ȩ; TV:
-// ˽ӿڶͼִ洢ʽͨò
-// ͼ֮໥תڹһĲҪж
+// ˽ӿڶͼĸִ洢ʽͨò
+// ͨTraversalVisitor棬visitorDFSBFSʹTraversalResultsռչʾ
+// ͼ֮໥תڹһĲҪж
+// ͼͨAddVertexAddEdgeRemoveEdge汾޸ͼ½ͼ
 template<typename TE, typename TV>
 class AbstractGraph
 {
 protected:
 	// ԱHostDFSRecursiveݹ汾ȱⲿ
-	// ͼʣδʶ㲢ʼݹ飬Լ
-	virtual void HostDFSRecursive() const = 0;
+	// ͼʣδʶ㲢ʼݹ
+	virtual void HostDFSRecursive(TraversalVisitor<TE>& visitor) const = 0;
 	// ԱDFSRecursiveݹ汾ȱʵʵֺ
 	// ڶΪĸϢ(Ƿѱʹ-ȱ)
 	virtual void DFSRecursive(
 		size_t current_vertex_index,
 		int& current_dfs_number,
 		vector<bool>& is_visited,
-		TraversalResults<TV>& traversal_results) const = 0;
+		TraversalVisitor<TE>& visitor) const = 0;
 	// ԱDFSIterative汾ȱʵʵֺ
-	virtual void DFSIterative() const = 0;
+	virtual void DFSIterative(TraversalVisitor<TE>& visitor) const = 0;
 
 	// ԱBFSImpȱʵʵֺ
 	virtual void BFSImp(
 		size_t current_vertex_index,
 		int& current_bfs_number,
 		vector<bool>& is_visited,
-		TraversalResults<TV>& traversal_results) const = 0;
+		TraversalVisitor<TE>& visitor) const = 0;
 
 public:
 	AbstractGraph() = default;
@@ -44,9 +53,119 @@ public:
 	// ԱDisplayGraphʾͼĶ㼰ڽӱ
 	virtual void DisplayGraph() const = 0;
 
-	// ԱDFSͼȱָǷʹõʵ֡
+	// ԱGetVertexDataȡ±궥
+	virtual const TV& GetVertexData(size_t vertex_index) const = 0;
+
+	// ԱDFSͼȱչʾָǷʹõʵ֡
 	virtual void DFS(bool is_iterative) const = 0;
 
-	// ԱBFSͼйȱ
+	// ԱDFSͼȱͨvisitor
+	virtual void DFS(bool is_iterative, TraversalVisitor<TE>& visitor) const = 0;
+
+	// ԱDFSExplicitStackʽջģݹȱչʾ
+	virtual void DFSExplicitStack() const = 0;
+
+	// ԱDFSExplicitStackʽջģݹȱͨvisitor
+	// ջÿһ֡Ϊ(±,öһڽӱߵα)ÿջһΣ
+	// ˳ʱֻO(V)Ķռ䡣˳򡢱߾ݹ汾ȫͬ
+	// ܵջȵƣڵݹ汾ջĴģ·ͼ
+	virtual void DFSExplicitStack(TraversalVisitor<TE>& visitor) const = 0;
+
+	// ԱBFSͼйȱչʾ
 	virtual void BFS() const = 0;
-};
\ No newline at end of file
+
+	// ԱBFSͼйȱͨvisitor
+	virtual void BFS(TraversalVisitor<TE>& visitor) const = 0;
+
+	// ԱConnectedComponentsͨţͼΪͨ
+	// ŰС±˳0ʼš
+	// thread_poolΪʱʹõ̲߳鼯ʹ̳߳еȫ̲߳м㣬߽ͬ
+	virtual vector<size_t> ConnectedComponents(ThreadPool* thread_pool = nullptr) const = 0;
+
+	// ԱAddVertexһûڽӱߵĶ㣬±
+	virtual size_t AddVertex(const TV& vertex_data) = 0;
+
+	// ԱAddEdgeӱ(begin_vertex_index,end_vertex_index)±Խʱfalse
+	// is_directedΪfalseʱ뽨ͼʱͬͬʱӷڽӹϵֻһ
+	// 洢ʽƽбߣѴʱֻȨ
+	// ڽӾO(1)ڽӱ̯O(1)״ɾʱO( + )
+	// CSRÿţΪO( +  + Ķ)Ӧʹ汾AddEdges
+	virtual bool AddEdge(
+		size_t begin_vertex_index,
+		size_t end_vertex_index,
+		const TE& cost,
+		bool is_directed) = 0;
+
+	// ԱRemoveEdgeɾһ(begin_vertex_index,end_vertex_index)ʱfalse
+	// is_directedΪfalseʱͬʱɾڽӹϵ
+	// ڽӾO(1)ڽӱO(Ķ)CSRΪO( + )
+	virtual bool RemoveEdge(
+		size_t begin_vertex_index,
+		size_t end_vertex_index,
+		bool is_directed) = 0;
+
+	// Ϊ汾Ĭʵõ
+	// ʺһԴһ޸ĵĴ洢ʽи
+
+	// ԱAddVertexesӸ㣬صһ¶±
+	virtual size_t AddVertexes(const vector<TV>& vertex_data);
+
+	// ԱAddEdgesӸ(±,յ±,Ȩ)ߣسɹӻµı
+	virtual size_t AddEdges(
+		const vector<tuple<size_t, size_t, TE>>& edges,
+		bool is_directed);
+
+	// ԱRemoveEdgesɾ(±,յ±)ߣسɹɾı
+	virtual size_t RemoveEdges(
+		const vector<pair<size_t, size_t>>& edges,
+		bool is_directed);
+};
+
+template<typename TE, typename TV>
+size_t AbstractGraph<TE, TV>::AddVertexes(const vector<TV>& vertex_data)
+{
+	size_t first_vertex_index = vertex_count;
+
+	for (auto& i : vertex_data)
+	{
+		AddVertex(i);
+	}
+
+	return first_vertex_index;
+}
+
+template<typename TE, typename TV>
+size_t AbstractGraph<TE, TV>::AddEdges(
+	const vector<tuple<size_t, size_t, TE>>& edges,
+	bool is_directed)
+{
+	size_t added_count = 0;
+
+	for (auto& i : edges)
+	{
+		if (AddEdge(get<0>(i), get<1>(i), get<2>(i), is_directed))
+		{
+			added_count++;
+		}
+	}
+
+	return added_count;
+}
+
+template<typename TE, typename TV>
+size_t AbstractGraph<TE, TV>::RemoveEdges(
+	const vector<pair<size_t, size_t>>& edges,
+	bool is_directed)
+{
+	size_t removed_count = 0;
+
+	for (auto& i : edges)
+	{
+		if (RemoveEdge(i.first, i.second, is_directed))
+		{
+			removed_count++;
+		}
+	}
+
+	return removed_count;
+}
\ No newline at end of file
@@ -8,10 +8,17 @@
 #include <queue>
 #include <tuple>
 #include <utility>
-#include <memory>
+#include <limits>
+#include <unordered_map>
+#include <functional>
+#include <span>
+#include <algorithm>
 
 #include "abstract_graph.h"
 #include "traversal_results.h"
+#include "connected_components.h"
+#include "thread_pool.h"
+#include "../Common/instrumentation.h"
 
 using std::cin;
 using std::cout;
@@ -24,24 +31,37 @@ using std::vector;
 using std::stack;
 using std::queue;
 using std::pair;
+using std::make_pair;
 using std::tuple;
 using std::get;
 using std::make_tuple;
-using std::shared_ptr;
-using std::make_shared;
+using std::numeric_limits;
+using std::span;
+using std::unordered_map;
 
 // ڽӱʵֵͼ
+// б߽ͬһ߳edge_pool_У߽֮ڱ߳е±ӣ
+// ͼ漰ߵĶѷüͼı߽߳һͷš
+// ÿͬʱ¼ĩβ߽㣬ӵıֱӽĩβ
+// ɾı߽֮ӵı߸á
+// ״ɾʱ(,յ)߽ɢ˺AddEdgeжϱǷѴΪO(1)
+// ÿӱߵľ̯ΪO(1)ɾڵвǰΪO(Ķ)
+// ֻͼ޸ĵͼûжڴ뽨ͼ
 template<typename TE, typename TV>
 class AdjacencyListGraph final :public AbstractGraph<TE, TV>
 {
 private:
+	// ʾӵı߽±
+	static constexpr size_t kNullEdge = numeric_limits<size_t>::max();
+
 	// 
 	class Edge final
 	{
 	public:
 		TE cost;
 		size_t adj_vertex_index = 0;
-		shared_ptr<Edge> next_edge = nullptr;
+		// ͬһһ߽ڱ߳е±
+		size_t next_edge = kNullEdge;
 
 		Edge() = default;
 		Edge(const TE& cost, size_t adj_vertex_index) :
@@ -59,7 +79,10 @@ private:
 	{
 	public:
 		TV data;
-		shared_ptr<Edge> first_edge = nullptr;
+		// ʼ߽ڱ߳е±
+		size_t first_edge = kNullEdge;
+		// ĩβ߽ڱ߳е±
+		size_t last_edge = kNullEdge;
 
 		Vertex() = default;
 		Vertex(const TV& data) :data(data) {}
@@ -69,22 +92,53 @@ private:
 	};
 
 	vector<Vertex> vertexes;
+	vector<Edge> edge_pool_;
+	// б߽׽±꣬н֮next_edge
+	size_t free_edge_ = kNullEdge;
+
+	struct EdgeKeyHash
+	{
+		size_t operator()(const pair<size_t, size_t>& edge_key) const
+		{
+			return std::hash<size_t>()(
+				edge_key.first * size_t(0x9E3779B97F4A7C15) ^ edge_key.second);
+		}
+	};
+
+	// (±,յ±)߽±ƽбʱָڽӱǰһ
+	// BuildEdgeIndex״ɾʱ֮ɾά½ͼʱ
+	unordered_map<pair<size_t, size_t>, size_t, EdgeKeyHash> edge_index_;
+	bool is_edge_index_built_ = false;
+
+	// ԱBuildEdgeIndexδʱȫ߽㽨֮ΪO( + )
+	void BuildEdgeIndex();
+
+	// ԱAppendEdgeڸڽӱĩβӱ߽㣬ȸÿб߽
+	void AppendEdge(size_t vertex_index, size_t adj_vertex_index, const TE& cost);
 
-	void HostDFSRecursive() const override;
+	// ԱSetEdgeңͨadj_vertex_indexı߽ʱȨ
+	// AppendEdgeӱ߽㣬O(1)µı߽ʱtrue
+	bool SetEdge(size_t vertex_index, size_t adj_vertex_index, const TE& cost);
+
+	// ԱUnlinkEdgeӸڽӱժһͨadj_vertex_indexı߽㣬
+	// ѽʱͬʱάʱfalse
+	bool UnlinkEdge(size_t vertex_index, size_t adj_vertex_index);
+
+	void HostDFSRecursive(TraversalVisitor<TE>& visitor) const override;
 
 	void DFSRecursive(
 		size_t current_vertex_index,
 		int& current_dfs_number,
 		vector<bool>& is_visited,
-		TraversalResults<TV>& traversal_results) const override;
+		TraversalVisitor<TE>& visitor) const override;
 
-	void DFSIterative() const override;
+	void DFSIterative(TraversalVisitor<TE>& visitor) const override;
 
 	void BFSImp(
 		size_t current_vertex_index,
 		int& current_bfs_number,
 		vector<bool>& is_visited,
-		TraversalResults<TV>& traversal_results) const override;
+		TraversalVisitor<TE>& visitor) const override;
 
 public:
 
@@ -93,10 +147,40 @@ public:
 
 	void DisplayGraph() const override;
 
+	const TV& GetVertexData(size_t vertex_index) const override;
+
 	void DFS(bool is_iterative) const override;
 
+	void DFS(bool is_iterative, TraversalVisitor<TE>& visitor) const override;
+
+	void DFSExplicitStack() const override;
+
+	void DFSExplicitStack(TraversalVisitor<TE>& visitor) const override;
+
 	void BFS() const override;
 
+	void BFS(TraversalVisitor<TE>& visitor) const override;
+
+	vector<size_t> ConnectedComponents(ThreadPool* thread_pool = nullptr) const override;
+
+	size_t AddVertex(const TV& vertex_data) override;
+
+	bool AddEdge(
+		size_t begin_vertex_index,
+		size_t end_vertex_index,
+		const TE& cost,
+		bool is_directed) override;
+
+	bool RemoveEdge(
+		size_t begin_vertex_index,
+		size_t end_vertex_index,
+		bool is_directed) override;
+
+	// ԱģForEachAdjacentEdgeڽ˳Ըÿڽӱߵ
+	// func(ڽӶ±, Ȩ)ڴ洢ʽͼ㷨ʹ
+	template<typename TFunc>
+	void ForEachAdjacentEdge(size_t vertex_index, TFunc&& func) const;
+
 	// ԱBuildGraphͼ
 	// graph_dataڽڽӱ洢ͼݰ
 	// tupleԱ1ݵ
@@ -111,8 +195,19 @@ public:
 	// ԱGetAdjacencyMatrixGraphData
 	// ȡڽӾʽǰͼAdjacencyMatrixGraphͶ
 	// BuildGraphԱĽͼ
-	auto GetAdjacencyMatrixGraphData(const TE infinity_cost)
-		->tuple<vector<TV>, vector<vector<TE>>, size_t, const TE> const;
+	// thread_poolΪʱ̳߳زд
+	auto GetAdjacencyMatrixGraphData(
+		const TE infinity_cost, ThreadPool* thread_pool = nullptr)
+		->tuple<vector<TV>, vector<TE>, size_t, const TE> const;
+
+	// ԱWriteAdjacencyMatrixڽӾд÷Ԥȷõcost_matrix
+	// iʼcost_matrix[i * stride]strideСڶÿֻдǰvertex_countԪء
+	// ڲڴ桢п̨thread_poolΪʱ̳߳زд
+	void WriteAdjacencyMatrix(
+		span<TE> cost_matrix,
+		size_t stride,
+		const TE& infinity_cost,
+		ThreadPool* thread_pool = nullptr) const;
 };
 
 template<typename TE, typename TV>
@@ -121,35 +216,262 @@ void AdjacencyListGraph<TE, TV>::BuildGraph(
 	vector<vector<pair<size_t, TE>>>,
 	size_t>& graph_data)
 {
+	DSE_INSTRUMENT_SCOPE("AdjacencyListGraph::BuildGraph");
+
 	auto& vex_data = get<0>(graph_data);
 	auto& vex_adj_data = get<1>(graph_data);
 
 	vertexes.clear();
+	edge_pool_.clear();
+	free_edge_ = kNullEdge;
+	edge_index_.clear();
+	is_edge_index_built_ = false;
 	this->vertex_count = vex_data.size();
 	this->edge_count = get<2>(graph_data);
 
+	// ʱreserveŻ·
+	DSE_INSTRUMENT_ADD(ALLOCATIONS, vertexes.capacity() < vex_data.size());
+	vertexes.reserve(vex_data.size());
+
 	for (auto& i : vex_data)
 	{
 		vertexes.emplace_back(std::move(i));
 	}
 
+	// ͳƱ߽һԷñ߳
+	size_t edge_node_count = 0;
+
+	for (auto& i : vex_adj_data)
+	{
+		edge_node_count += i.size();
+	}
+
+	DSE_INSTRUMENT_ADD(ALLOCATIONS, edge_pool_.capacity() < edge_node_count);
+	edge_pool_.reserve(edge_node_count);
+
 	for (size_t i = 0; i < vex_adj_data.size(); i++)
 	{
-		// ָָָ룬ڽͼʱ޸Ķʼָ߽
-		// ߽һָָ߽
-		shared_ptr<Edge>* current_edge_ptr = &(vertexes[i].first_edge);
+		// ָ±ָ룬ڽͼʱ޸Ķʼ߽±
+		// ߽һ߽±
+		size_t* current_edge_link = &(vertexes[i].first_edge);
 
 		for (auto& j : vex_adj_data[i])
 		{
-			// õǰҪ޸ĵıָָ߽½ı߽
-			*current_edge_ptr =
-				make_shared<Edge>(std::move(j.second), j.first);
-			// öָָǰָ߽next_edgeԱ
-			current_edge_ptr = &((*current_edge_ptr)->next_edge);
+			// õǰҪ޸ĵָ¼߳صı߽
+			*current_edge_link = edge_pool_.size();
+			edge_pool_.emplace_back(std::move(j.second), j.first);
+			// ߳Ԥ׷ӲʹָʧЧ
+			current_edge_link = &(edge_pool_.back().next_edge);
+		}
+
+		if (!vex_adj_data[i].empty())
+		{
+			vertexes[i].last_edge = edge_pool_.size() - 1;
 		}
 	}
 }
 
+template<typename TE, typename TV>
+void AdjacencyListGraph<TE, TV>::AppendEdge(
+	size_t vertex_index, size_t adj_vertex_index, const TE& cost)
+{
+	size_t new_edge = free_edge_;
+
+	if (new_edge != kNullEdge)
+	{
+		free_edge_ = edge_pool_[new_edge].next_edge;
+		edge_pool_[new_edge] = Edge(cost, adj_vertex_index);
+	}
+	else
+	{
+		new_edge = edge_pool_.size();
+		edge_pool_.emplace_back(cost, adj_vertex_index);
+	}
+
+	Vertex& vertex = vertexes[vertex_index];
+
+	if (vertex.last_edge == kNullEdge)
+	{
+		vertex.first_edge = new_edge;
+	}
+	else
+	{
+		edge_pool_[vertex.last_edge].next_edge = new_edge;
+	}
+
+	vertex.last_edge = new_edge;
+}
+
+template<typename TE, typename TV>
+void AdjacencyListGraph<TE, TV>::BuildEdgeIndex()
+{
+	if (is_edge_index_built_)
+	{
+		return;
+	}
+
+	edge_index_.reserve(edge_pool_.size());
+
+	for (size_t i = 0; i < vertexes.size(); i++)
+	{
+		for (size_t current_edge = vertexes[i].first_edge;
+			current_edge != kNullEdge;
+			current_edge = edge_pool_[current_edge].next_edge)
+		{
+			// ƽбֻ¼ǰһUnlinkEdgeժ˳һ
+			edge_index_.try_emplace(
+				make_pair(i, edge_pool_[current_edge].adj_vertex_index), current_edge);
+		}
+	}
+
+	is_edge_index_built_ = true;
+}
+
+template<typename TE, typename TV>
+bool AdjacencyListGraph<TE, TV>::SetEdge(
+	size_t vertex_index, size_t adj_vertex_index, const TE& cost)
+{
+	BuildEdgeIndex();
+
+	auto [edge_iterator, is_inserted] = edge_index_.try_emplace(
+		make_pair(vertex_index, adj_vertex_index), kNullEdge);
+
+	if (!is_inserted)
+	{
+		edge_pool_[edge_iterator->second].cost = cost;
+
+		return false;
+	}
+
+	AppendEdge(vertex_index, adj_vertex_index, cost);
+	edge_iterator->second = vertexes[vertex_index].last_edge;
+
+	return true;
+}
+
+template<typename TE, typename TV>
+bool AdjacencyListGraph<TE, TV>::UnlinkEdge(
+	size_t vertex_index, size_t adj_vertex_index)
+{
+	Vertex& vertex = vertexes[vertex_index];
+
+	size_t previous_edge = kNullEdge;
+	size_t current_edge = vertex.first_edge;
+
+	while (current_edge != kNullEdge
+		&& edge_pool_[current_edge].adj_vertex_index != adj_vertex_index)
+	{
+		previous_edge = current_edge;
+		current_edge = edge_pool_[current_edge].next_edge;
+	}
+
+	if (current_edge == kNullEdge)
+	{
+		return false;
+	}
+
+	size_t next_edge = edge_pool_[current_edge].next_edge;
+
+	if (previous_edge == kNullEdge)
+	{
+		vertex.first_edge = next_edge;
+	}
+	else
+	{
+		edge_pool_[previous_edge].next_edge = next_edge;
+	}
+
+	if (vertex.last_edge == current_edge)
+	{
+		vertex.last_edge = previous_edge;
+	}
+
+	edge_pool_[current_edge].next_edge = free_edge_;
+	free_edge_ = current_edge;
+
+	if (is_edge_index_built_)
+	{
+		// ͨadj_vertex_indexƽбʱΪָǰһ
+		size_t parallel_edge = next_edge;
+
+		while (parallel_edge != kNullEdge
+			&& edge_pool_[parallel_edge].adj_vertex_index != adj_vertex_index)
+		{
+			parallel_edge = edge_pool_[parallel_edge].next_edge;
+		}
+
+		if (parallel_edge == kNullEdge)
+		{
+			edge_index_.erase(make_pair(vertex_index, adj_vertex_index));
+		}
+		else
+		{
+			edge_index_[make_pair(vertex_index, adj_vertex_index)] = parallel_edge;
+		}
+	}
+
+	return true;
+}
+
+template<typename TE, typename TV>
+size_t AdjacencyListGraph<TE, TV>::AddVertex(const TV& vertex_data)
+{
+	vertexes.emplace_back(vertex_data);
+
+	return this->vertex_count++;
+}
+
+template<typename TE, typename TV>
+bool AdjacencyListGraph<TE, TV>::AddEdge(
+	size_t begin_vertex_index,
+	size_t end_vertex_index,
+	const TE& cost,
+	bool is_directed)
+{
+	if (begin_vertex_index >= this->vertex_count
+		|| end_vertex_index >= this->vertex_count)
+	{
+		return false;
+	}
+
+	bool is_new_edge = SetEdge(begin_vertex_index, end_vertex_index, cost);
+
+	if (!is_directed)
+	{
+		SetEdge(end_vertex_index, begin_vertex_index, cost);
+	}
+
+	if (is_new_edge)
+	{
+		this->edge_count++;
+	}
+
+	return true;
+}
+
+template<typename TE, typename TV>
+bool AdjacencyListGraph<TE, TV>::RemoveEdge(
+	size_t begin_vertex_index,
+	size_t end_vertex_index,
+	bool is_directed)
+{
+	if (begin_vertex_index >= this->vertex_count
+		|| end_vertex_index >= this->vertex_count
+		|| !UnlinkEdge(begin_vertex_index, end_vertex_index))
+	{
+		return false;
+	}
+
+	if (!is_directed)
+	{
+		UnlinkEdge(end_vertex_index, begin_vertex_index);
+	}
+
+	this->edge_count--;
+
+	return true;
+}
+
 template<typename TE, typename TV>
 void AdjacencyListGraph<TE, TV>::DisplayGraph() const
 {
@@ -159,14 +481,14 @@ void AdjacencyListGraph<TE, TV>::DisplayGraph() const
 	{
 		cout << format("{0}: {1} ", i, vertexes[i].data);
 
-		for (shared_ptr<Edge> j = vertexes[i].first_edge;
-			j != nullptr;
-			j = j->next_edge)
+		for (size_t j = vertexes[i].first_edge;
+			j != kNullEdge;
+			j = edge_pool_[j].next_edge)
 		{
 			cout << format("([{0}]{1}@{2}) ",
-				j->adj_vertex_index,
-				vertexes[j->adj_vertex_index].data,
-				j->cost);
+				edge_pool_[j].adj_vertex_index,
+				vertexes[edge_pool_[j].adj_vertex_index].data,
+				edge_pool_[j].cost);
 		}
 
 		cout << endl;
@@ -175,43 +497,69 @@ void AdjacencyListGraph<TE, TV>::DisplayGraph() const
 	cout << endl;
 }
 
+template<typename TE, typename TV>
+const TV& AdjacencyListGraph<TE, TV>::GetVertexData(size_t vertex_index) const
+{
+	return vertexes[vertex_index].data;
+}
+
+template<typename TE, typename TV>
+template<typename TFunc>
+void AdjacencyListGraph<TE, TV>::ForEachAdjacentEdge(
+	size_t vertex_index, TFunc&& func) const
+{
+	for (size_t i = vertexes[vertex_index].first_edge;
+		i != kNullEdge;
+		i = edge_pool_[i].next_edge)
+	{
+		func(edge_pool_[i].adj_vertex_index, edge_pool_[i].cost);
+	}
+}
+
 template<typename TE, typename TV>
 void AdjacencyListGraph<TE, TV>::DFS(bool is_iterative) const
+{
+	TraversalResults<TE, TV> traversal_results(
+		this->vertex_count,
+		is_iterative ?
+		TraversalResultsType::DFS_ITERATIVE : TraversalResultsType::DFS_RECURSIVE);
+
+	DFS(is_iterative, traversal_results);
+
+	TraversalResults<TE, TV>::DisplayTraversalResults(traversal_results, *this);
+}
+
+template<typename TE, typename TV>
+void AdjacencyListGraph<TE, TV>::DFS(
+	bool is_iterative, TraversalVisitor<TE>& visitor) const
 {
 	if (is_iterative)
 	{
-		DFSIterative();
+		DFSIterative(visitor);
 	}
 	else
 	{
-		HostDFSRecursive();
+		HostDFSRecursive(visitor);
 	}
 }
 
 template<typename TE, typename TV>
-void AdjacencyListGraph<TE, TV>::HostDFSRecursive() const
+void AdjacencyListGraph<TE, TV>::HostDFSRecursive(
+	TraversalVisitor<TE>& visitor) const
 {
-	vector<bool> is_visited(this->vertex_count);
+	DSE_INSTRUMENT_SCOPE("AdjacencyListGraph::DFSRecursive");
 
-	TraversalResults<TV> traversal_results(
-		this->vertex_count, TraversalResultsType::DFS_RECURSIVE);
+	vector<bool> is_visited(this->vertex_count);
 
 	int dfs_number_initial = 0;
 
-	size_t component_count = 0;
-
 	for (size_t i = 0; i < this->vertex_count; i++)
 	{
 		if (!is_visited[i])
 		{
-			component_count++;
-			DFSRecursive(i, dfs_number_initial, is_visited, traversal_results);
+			DFSRecursive(i, dfs_number_initial, is_visited, visitor);
 		}
 	}
-
-	// cout << "NUMBER OF CONNECTED COMPONENT(s):" << component_count << endl << endl;
-
-	TraversalResults<TV>::DisplayTraversalResults(traversal_results);
 }
 
 template<typename TE, typename TV>
@@ -219,48 +567,45 @@ void AdjacencyListGraph<TE, TV>::DFSRecursive(
 	size_t current_vertex_index,
 	int& current_dfs_number,
 	vector<bool>& is_visited,
-	TraversalResults<TV>& traversal_results) const
+	TraversalVisitor<TE>& visitor) const
 {
-	is_visited[current_vertex_index] = true;
+	DSE_INSTRUMENT_COUNTERS("AdjacencyListGraph::DFSRecursive");
+	DSE_INSTRUMENT_DEPTH();
+	DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
 
-	traversal_results.traversal_numbers[current_vertex_index] =
-		format("([{0}]{1}:{2})",
-			current_vertex_index,
-			vertexes[current_vertex_index].data,
-			current_dfs_number++);
+	is_visited[current_vertex_index] = true;
 
-	traversal_results.traversal_list.emplace_back(
-		format("([{0}]{1})",
-			current_vertex_index, vertexes[current_vertex_index].data));
+	visitor.OnVertexVisited(current_vertex_index, current_dfs_number++);
 
-	for (auto i = vertexes[current_vertex_index].first_edge;
-		i != nullptr;
-		i = i->next_edge)
+	for (size_t i = vertexes[current_vertex_index].first_edge;
+		i != kNullEdge;
+		i = edge_pool_[i].next_edge)
 	{
-		if (!is_visited[i->adj_vertex_index])
+		const Edge& current_edge = edge_pool_[i];
+
+		DSE_INSTRUMENT_ADD(EDGES_SCANNED, 1);
+
+		if (!is_visited[current_edge.adj_vertex_index])
 		{
-			traversal_results.spanning_tree_edges.emplace_back(
-				format("([{0}]{1}-[{2}]{3}@{4})",
-					current_vertex_index,
-					vertexes[current_vertex_index].data,
-					i->adj_vertex_index,
-					vertexes[i->adj_vertex_index].data,
-					i->cost));
+			visitor.OnSpanningTreeEdge(
+				current_vertex_index,
+				current_edge.adj_vertex_index,
+				current_edge.cost);
 
 			DFSRecursive(
-				i->adj_vertex_index, current_dfs_number,
-				is_visited, traversal_results);
+				current_edge.adj_vertex_index, current_dfs_number,
+				is_visited, visitor);
 		}
 	}
 }
 
 template<typename TE, typename TV>
-void AdjacencyListGraph<TE, TV>::DFSIterative() const
+void AdjacencyListGraph<TE, TV>::DFSIterative(
+	TraversalVisitor<TE>& visitor) const
 {
-	vector<bool> is_visited(this->vertex_count);
+	DSE_INSTRUMENT_SCOPE("AdjacencyListGraph::DFSIterative");
 
-	TraversalResults<TV> traversal_results(
-		this->vertex_count, TraversalResultsType::DFS_ITERATIVE);
+	vector<bool> is_visited(this->vertex_count);
 
 	stack<size_t> dfs_stack;
 
@@ -291,59 +636,178 @@ void AdjacencyListGraph<TE, TV>::DFSIterative() const
 
 			is_visited[current_vertex_index] = true;
 
-			traversal_results.traversal_numbers[current_vertex_index] =
-				format("([{0}]{1}:{2})",
-					current_vertex_index,
-					vertexes[current_vertex_index].data,
-					current_dfs_number++);
+			DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
 
-			traversal_results.traversal_list.emplace_back(format("([{0}]{1})",
-				current_vertex_index, vertexes[current_vertex_index].data));
+			visitor.OnVertexVisited(current_vertex_index, current_dfs_number++);
 
-			for (auto j = vertexes[current_vertex_index].first_edge;
-				j != nullptr;
-				j = j->next_edge)
+			for (size_t j = vertexes[current_vertex_index].first_edge;
+				j != kNullEdge;
+				j = edge_pool_[j].next_edge)
 			{
-				if (!is_visited[j->adj_vertex_index])
+				const Edge& current_edge = edge_pool_[j];
+
+				DSE_INSTRUMENT_ADD(EDGES_SCANNED, 1);
+
+				if (!is_visited[current_edge.adj_vertex_index])
 				{
-					traversal_results.spanning_tree_edges.emplace_back(
-						format("([{0}]{1}-[{2}]{3}@{4})",
-							current_vertex_index,
-							vertexes[current_vertex_index].data,
-							j->adj_vertex_index,
-							vertexes[j->adj_vertex_index].data,
-							j->cost));
+					visitor.OnSpanningTreeEdge(
+						current_vertex_index,
+						current_edge.adj_vertex_index,
+						current_edge.cost);
 
-					// is_visited[j->adj_vertex_index] = true;
+					// is_visited[current_edge.adj_vertex_index] = true;
 
-					dfs_stack.push(j->adj_vertex_index);
+					dfs_stack.push(current_edge.adj_vertex_index);
+
+					DSE_INSTRUMENT_PEAK(PEAK_DEPTH, dfs_stack.size());
 				}
 			}
 		}
 	}
+}
 
-	TraversalResults<TV>::DisplayTraversalResults(traversal_results);
+template<typename TE, typename TV>
+void AdjacencyListGraph<TE, TV>::DFSExplicitStack() const
+{
+	TraversalResults<TE, TV> traversal_results(
+		this->vertex_count, TraversalResultsType::DFS_EXPLICIT_STACK);
+
+	DFSExplicitStack(traversal_results);
+
+	TraversalResults<TE, TV>::DisplayTraversalResults(traversal_results, *this);
 }
 
 template<typename TE, typename TV>
-void AdjacencyListGraph<TE, TV>::BFS() const
+void AdjacencyListGraph<TE, TV>::DFSExplicitStack(
+	TraversalVisitor<TE>& visitor) const
 {
+	DSE_INSTRUMENT_SCOPE("AdjacencyListGraph::DFSExplicitStack");
+
 	vector<bool> is_visited(this->vertex_count);
 
-	TraversalResults<TV> traversal_results(
+	// ÿһ֡Ϊ(±,һı߽±)൱ڵݹ汾һõľֲ״̬
+	vector<pair<size_t, size_t>> dfs_stack;
+
+	int current_dfs_number = 0;
+
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		if (is_visited[i])
+		{
+			continue;
+		}
+
+		is_visited[i] = true;
+
+		DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
+
+		visitor.OnVertexVisited(i, current_dfs_number++);
+
+		dfs_stack.emplace_back(i, vertexes[i].first_edge);
+
+		while (!dfs_stack.empty())
+		{
+			auto& [current_vertex_index, current_edge_index] = dfs_stack.back();
+
+			if (current_edge_index == kNullEdge)
+			{
+				dfs_stack.pop_back();
+				continue;
+			}
+
+			const Edge& current_edge = edge_pool_[current_edge_index];
+
+			// ƽαջ֡ջʹջ֡ʧЧ
+			current_edge_index = current_edge.next_edge;
+
+			DSE_INSTRUMENT_ADD(EDGES_SCANNED, 1);
+
+			if (!is_visited[current_edge.adj_vertex_index])
+			{
+				visitor.OnSpanningTreeEdge(
+					current_vertex_index,
+					current_edge.adj_vertex_index,
+					current_edge.cost);
+
+				is_visited[current_edge.adj_vertex_index] = true;
+
+				DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
+
+				visitor.OnVertexVisited(
+					current_edge.adj_vertex_index, current_dfs_number++);
+
+				dfs_stack.emplace_back(
+					current_edge.adj_vertex_index,
+					vertexes[current_edge.adj_vertex_index].first_edge);
+
+				DSE_INSTRUMENT_PEAK(PEAK_DEPTH, dfs_stack.size());
+			}
+		}
+	}
+}
+
+template<typename TE, typename TV>
+void AdjacencyListGraph<TE, TV>::WriteAdjacencyMatrix(
+	span<TE> cost_matrix,
+	size_t stride,
+	const TE& infinity_cost,
+	ThreadPool* thread_pool) const
+{
+	// лص·дڽӱ
+	auto write_rows = [&](size_t, size_t chunk_begin, size_t chunk_end)
+	{
+		for (size_t i = chunk_begin; i < chunk_end; i++)
+		{
+			TE* current_row = cost_matrix.data() + i * stride;
+
+			std::fill_n(current_row, this->vertex_count, infinity_cost);
+
+			for (size_t j = vertexes[i].first_edge; j != kNullEdge; j = edge_pool_[j].next_edge)
+			{
+				current_row[edge_pool_[j].adj_vertex_index] = edge_pool_[j].cost;
+			}
+
+			current_row[i] = 0;
+		}
+	};
+
+	if (thread_pool != nullptr)
+	{
+		thread_pool->ParallelFor(0, this->vertex_count, write_rows);
+	}
+	else
+	{
+		write_rows(0, 0, this->vertex_count);
+	}
+}
+
+template<typename TE, typename TV>
+void AdjacencyListGraph<TE, TV>::BFS() const
+{
+	TraversalResults<TE, TV> traversal_results(
 		this->vertex_count, TraversalResultsType::BFS);
 
+	BFS(traversal_results);
+
+	TraversalResults<TE, TV>::DisplayTraversalResults(traversal_results, *this);
+}
+
+template<typename TE, typename TV>
+void AdjacencyListGraph<TE, TV>::BFS(TraversalVisitor<TE>& visitor) const
+{
+	DSE_INSTRUMENT_SCOPE("AdjacencyListGraph::BFS");
+
+	vector<bool> is_visited(this->vertex_count);
+
 	int bfs_number_initial = 0;
 
 	for (size_t i = 0; i < this->vertex_count; i++)
 	{
 		if (!is_visited[i])
 		{
-			BFSImp(i, bfs_number_initial, is_visited, traversal_results);
+			BFSImp(i, bfs_number_initial, is_visited, visitor);
 		}
 	}
-
-	TraversalResults<TV>::DisplayTraversalResults(traversal_results);
 }
 
 template<typename TE, typename TV>
@@ -351,8 +815,10 @@ void AdjacencyListGraph<TE, TV>::BFSImp(
 	size_t current_vertex_index,
 	int& current_bfs_number,
 	vector<bool>& is_visited,
-	TraversalResults<TV>& traversal_results) const
+	TraversalVisitor<TE>& visitor) const
 {
+	DSE_INSTRUMENT_COUNTERS("AdjacencyListGraph::BFS");
+
 	queue<size_t> bfs_queue;
 
 	bfs_queue.push(current_vertex_index);
@@ -371,65 +837,62 @@ void AdjacencyListGraph<TE, TV>::BFSImp(
 		size_t current_vertex_index = bfs_queue.front();
 		bfs_queue.pop();
 
-		traversal_results.traversal_numbers[current_vertex_index] =
-			format("([{0}]{1}:{2})",
-				current_vertex_index,
-				vertexes[current_vertex_index].data,
-				current_bfs_number++);
+		DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
 
-		traversal_results.traversal_list.emplace_back(format("([{0}]{1})",
-			current_vertex_index, vertexes[current_vertex_index].data));
+		visitor.OnVertexVisited(current_vertex_index, current_bfs_number++);
 
-		for (auto i = vertexes[current_vertex_index].first_edge;
-			i != nullptr;
-			i = i->next_edge)
+		for (size_t i = vertexes[current_vertex_index].first_edge;
+			i != kNullEdge;
+			i = edge_pool_[i].next_edge)
 		{
-			if (!is_visited[i->adj_vertex_index])
+			const Edge& current_edge = edge_pool_[i];
+
+			DSE_INSTRUMENT_ADD(EDGES_SCANNED, 1);
+
+			if (!is_visited[current_edge.adj_vertex_index])
 			{
-				traversal_results.spanning_tree_edges.emplace_back(
-					format("([{0}]{1}-[{2}]{3}@{4})",
-						current_vertex_index,
-						vertexes[current_vertex_index].data,
-						i->adj_vertex_index,
-						vertexes[i->adj_vertex_index].data,
-						i->cost));
+				visitor.OnSpanningTreeEdge(
+					current_vertex_index,
+					current_edge.adj_vertex_index,
+					current_edge.cost);
+
+				is_visited[current_edge.adj_vertex_index] = true;
 
-				is_visited[i->adj_vertex_index] = true;
+				bfs_queue.push(current_edge.adj_vertex_index);
 
-				bfs_queue.push(i->adj_vertex_index);
+				DSE_INSTRUMENT_PEAK(PEAK_DEPTH, bfs_queue.size());
 			}
 		}
 	}
 }
 
 template<typename TE, typename TV>
-auto AdjacencyListGraph<TE, TV>::GetAdjacencyMatrixGraphData(
-	const TE infinity_cost)
-	->tuple<vector<TV>, vector<vector<TE>>, size_t, const TE> const
+vector<size_t> AdjacencyListGraph<TE, TV>::ConnectedComponents(ThreadPool* thread_pool) const
 {
-	vector<TV> result_vertexes;
-	vector<vector<TE>> result_edges;
-
-	for (auto& i : vertexes)
+	if (thread_pool != nullptr)
 	{
-		result_vertexes.push_back(i.data);
+		return ComponentLabeler::Parallel(*this, *thread_pool);
+	}
 
-		vector<TE> current_edge_data(this->vertex_count, infinity_cost);
+	return ComponentLabeler::UnionFind(*this);
+}
 
-		for (auto j = i.first_edge; j != nullptr; j = j->next_edge)
-		{
-			current_edge_data[j->adj_vertex_index] = j->cost;
-		}
+template<typename TE, typename TV>
+auto AdjacencyListGraph<TE, TV>::GetAdjacencyMatrixGraphData(
+	const TE infinity_cost, ThreadPool* thread_pool)
+	->tuple<vector<TV>, vector<TE>, size_t, const TE> const
+{
+	vector<TV> result_vertexes;
+	vector<TE> result_edges(this->vertex_count * this->vertex_count);
 
-		result_edges.emplace_back(std::move(current_edge_data));
-	}
+	result_vertexes.reserve(this->vertex_count);
 
 	for (size_t i = 0; i < this->vertex_count; i++)
 	{
-		result_edges[i][i] = 0;
+		result_vertexes.push_back(vertexes[i].data);
 	}
 
-	cout << "<CONVERTED FROM ADJ-LIST GRAPH TO ADJ-MATRIX GRAPH.>" << endl << endl;
+	WriteAdjacencyMatrix(result_edges, this->vertex_count, infinity_cost, thread_pool);
 
 	return make_tuple(
 		std::move(result_vertexes),
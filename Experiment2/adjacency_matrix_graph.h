@@ -7,10 +7,24 @@
 #include <stack>
 #include <queue>
 #include <tuple>
+#include <span>
 #include <utility>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 #include "abstract_graph.h"
+#include "aligned_allocator.h"
 #include "traversal_results.h"
+#include "connected_components.h"
+#include "floyd_warshall.h"
+#include "thread_pool.h"
+#include "../Common/instrumentation.h"
 
 using std::cin;
 using std::cout;
@@ -24,33 +38,110 @@ using std::stack;
 using std::queue;
 using std::pair;
 using std::tuple;
+using std::span;
 using std::get;
 using std::make_tuple;
+using std::uint64_t;
+using std::popcount;
+using std::countr_zero;
+
+// ڽӾĴ洢ʽ
+enum class MatrixStorageMode
+{
+	// 洢Ȩ
+	COST_MATRIX,
+	// ڱȨ֮洢λѹıߴԾ󣬱ʱֲɨ
+	COST_MATRIX_WITH_BITSET,
+	// 洢ߴλֻͨϵĳϣбߵıȨΪ1
+	BITSET_ONLY
+};
 
 // ڽӾʵֵͼ
 template<typename TE, typename TV>
 class AdjacencyMatrixGraph final :public AbstractGraph<TE, TV>
 {
 private:
+	// ȨĶֽ뻺дСһ£ͬʱAVX/AVX-512ĶҪ
+	static constexpr size_t kCostAlignment = 64;
+
 	vector<TV> vertexes;
-	vector<vector<TE>> edges;
+	// ȨһĻУÿռcost_stride_Ԫأ
+	// гΪkCostAlignmentֽڵıʹÿʼַ룻벿infinity_cost_
+	vector<TE, AlignedAllocator<TE, kCostAlignment>> edges;
+	size_t cost_stride_ = 0;
 	TE infinity_cost_ = 0x3F3F3F3F;
 
-	void HostDFSRecursive() const override;
+	static constexpr size_t kBitsPerWord = 64;
+
+	MatrixStorageMode storage_mode_ = MatrixStorageMode::COST_MATRIX;
+	// ߴλÿռwords_per_row_64λ֣iеjλΪ1ʾڱ(i,j)
+	vector<uint64_t> edge_bits_;
+	size_t words_per_row_ = 0;
+
+	// ̬ԱGetCostStrideȡΪvertex_countʱȨг
+	static size_t GetCostStride(size_t vertex_count);
+
+	// ԱGetCostRowȡȨrow_indexеʼַ
+	const TE* GetCostRow(size_t row_index) const;
+	TE* GetCostRow(size_t row_index);
+
+	// ԱGetEdgeCostȡ(begin_vertex_index,end_vertex_index)ıȨ
+	TE GetEdgeCost(size_t begin_vertex_index, size_t end_vertex_index) const;
+
+	// ԱSetEdgeñ(begin_vertex_index,end_vertex_index)ıȨλ
+	// costΪ0infinity_cost_ʱʾޱ
+	void SetEdge(size_t begin_vertex_index, size_t end_vertex_index, const TE& cost);
+
+	// ԱGrowMatrixӵnew_vertex_countչоΪޱ
+	// λÿеʹӶľ̯붥
+	void GrowMatrix(size_t new_vertex_count);
+
+	// ԱGetEdgeMaskWordȡrow_indexеword_index64зıߴ룬
+	// jλΪ1ʾڱ(row_index, word_index * 64 + j)λʱֱӶȡ
+	// ԱȨĸöԪرȽϣСinfinity_cost_ѹΪ룬AVX2ÿαȽ8Ԫ
+	uint64_t GetEdgeMaskWord(size_t row_index, size_t word_index) const;
+
+	// ԱFindNextUnvisitedAdjVertexλĵrow_indexУ
+	// ӵbegin_column_indexпʼһδʵڽӶ㣬ʱvertex_count
+	size_t FindNextUnvisitedAdjVertex(
+		size_t row_index,
+		size_t begin_column_index,
+		const vector<uint64_t>& visited_bits) const;
+
+	// Ϊλıʵ֣ʱͬλ洢
+	// һеȫδڽӶͨ( & ~)һɸѡ
+	void DFSRecursiveBitset(
+		size_t current_vertex_index,
+		int& current_dfs_number,
+		vector<uint64_t>& visited_bits,
+		TraversalVisitor<TE>& visitor) const;
+
+	void DFSIterativeBitset(TraversalVisitor<TE>& visitor) const;
+
+	void DFSExplicitStackBitset(TraversalVisitor<TE>& visitor) const;
+
+	void BFSBitsetImp(
+		size_t current_vertex_index,
+		int& current_bfs_number,
+		vector<uint64_t>& visited_bits,
+		size_t& unvisited_count,
+		TraversalVisitor<TE>& visitor) const;
+
+	void HostDFSRecursive(TraversalVisitor<TE>& visitor) const override;
 
 	void DFSRecursive(
 		size_t current_vertex_index,
 		int& current_dfs_number,
 		vector<bool>& is_visited,
-		TraversalResults<TV>& traversal_results) const override;
+		TraversalVisitor<TE>& visitor) const override;
 
-	void DFSIterative() const override;
+	void DFSIterative(TraversalVisitor<TE>& visitor) const override;
 
 	void BFSImp(
 		size_t current_vertex_index,
 		int& current_bfs_number,
 		vector<bool>& is_visited,
-		TraversalResults<TV>& traversal_results) const override;
+		TraversalVisitor<TE>& visitor) const override;
 
 public:
 	AdjacencyMatrixGraph() = default;
@@ -58,38 +149,125 @@ public:
 
 	void DisplayGraph()  const override;
 
+	const TV& GetVertexData(size_t vertex_index) const override;
+
 	void DFS(bool is_iterative) const override;
 
+	void DFS(bool is_iterative, TraversalVisitor<TE>& visitor) const override;
+
+	void DFSExplicitStack() const override;
+
+	void DFSExplicitStack(TraversalVisitor<TE>& visitor) const override;
+
 	void BFS() const override;
 
+	void BFS(TraversalVisitor<TE>& visitor) const override;
+
+	vector<size_t> ConnectedComponents(ThreadPool* thread_pool = nullptr) const override;
+
+	// ԱAllPairsShortestPathsԷֿFloyd-Warshall㷨ȫԴ·
+	// ڽӾһݰгΪֿСĸϽУ޸ͼ
+	// thread_poolΪʱִ߳Уֿ̳߳زдͼвôڸ
+	AllPairsShortestPathResults<TE> AllPairsShortestPaths(
+		ThreadPool* thread_pool = nullptr) const;
+
+	// ڽӾӶչһһУ붥
+	size_t AddVertex(const TV& vertex_data) override;
+
+	size_t AddVertexes(const vector<TV>& vertex_data) override;
+
+	// ڽӾ0ͲСinfinity_cost_ıȨʾޱߣcost޷ʾһߣfalse
+	bool AddEdge(
+		size_t begin_vertex_index,
+		size_t end_vertex_index,
+		const TE& cost,
+		bool is_directed) override;
+
+	bool RemoveEdge(
+		size_t begin_vertex_index,
+		size_t end_vertex_index,
+		bool is_directed) override;
+
+	// ԱģForEachAdjacentEdgeڽ˳Ըÿڽӱߵ
+	// func(ڽӶ±, Ȩ)ڴ洢ʽͼ㷨ʹ
+	template<typename TFunc>
+	void ForEachAdjacentEdge(size_t vertex_index, TFunc&& func) const;
+
 	// ԱBuildGraphͼ
 	// graph_dataڽڽӱ洢ͼݰ
 	// tupleԱ1ݵ
-	// tupleԱ2ڽӾάtupleԱ3ʾ·
+	// tupleԱ2ŵvertex_count * vertex_countڽӾtupleԱ4ʾ·
 	// tupleԱ3ߵ
 	// tupleԱ4ʾ·TEͳ
+	// storage_modeڽӾĴ洢ʽĬϽ洢Ȩ
 	void BuildGraph(
 		const tuple<vector<TV>,
-		vector<vector<TE>>,
+		vector<TE>,
 		size_t,
-		const TE>& graph_data);
+		const TE>& graph_data,
+		MatrixStorageMode storage_mode = MatrixStorageMode::COST_MATRIX);
+
+	// ԱBuildGraphԵ÷еݽͼֻȡһ
+	// costsŵڽӾ󣬵iʼcosts[i * source_stride]
+	// ÿvertex_data.size()Ԫأsource_strideΪ0ʱΪvertex_data.size()
+	void BuildGraph(
+		span<const TV> vertex_data,
+		span<const TE> costs,
+		size_t source_stride,
+		size_t edge_count,
+		const TE& infinity_cost,
+		MatrixStorageMode storage_mode = MatrixStorageMode::COST_MATRIX);
 
 	// ԱGetAdjacencyListGraphData
 	// ȡڽӱʽǰͼAdjacencyListGraphͶ
 	// BuildGraphԱĽͼ
-	auto GetAdjacencyListGraphData() const
+	// thread_poolΪʱ̳߳زת
+	auto GetAdjacencyListGraphData(ThreadPool* thread_pool = nullptr) const
 		->tuple<vector<TV>,
 		const vector<vector<pair<size_t, TE>>>,
 		size_t>;
+
+	// ͼΪCSRʽ飬ɵ÷Ԥȷãڲڴ桢п̨
+	// thread_poolΪʱ̳߳زд
+
+	// ԱGetAdjacencyOffsetsͳƸڽӱǰ׺ͣд볤Ϊ + 1offsets
+	// ڽӱExportAdjacencyArraysĳ
+	size_t GetAdjacencyOffsets(span<size_t> offsets, ThreadPool* thread_pool = nullptr) const;
+
+	// ԱExportAdjacencyArraysGetAdjacencyOffsetsõoffsets
+	// ѸеڽӶ±Ȩ±дadj_vertex_indexescosts
+	void ExportAdjacencyArrays(
+		span<const size_t> offsets,
+		span<size_t> adj_vertex_indexes,
+		span<TE> costs,
+		ThreadPool* thread_pool = nullptr) const;
 };
 
 template<typename TE, typename TV>
-void AdjacencyMatrixGraph<TE, TV>::HostDFSRecursive() const
+void AdjacencyMatrixGraph<TE, TV>::HostDFSRecursive(
+	TraversalVisitor<TE>& visitor) const
 {
-	vector<bool> is_visited(this->vertex_count);
+	DSE_INSTRUMENT_SCOPE("AdjacencyMatrixGraph::DFSRecursive");
+
+	if (storage_mode_ != MatrixStorageMode::COST_MATRIX)
+	{
+		vector<uint64_t> visited_bits(words_per_row_);
+
+		int dfs_number_initial = 0;
+
+		for (size_t i = 0; i < this->vertex_count; i++)
+		{
+			if (!((visited_bits[i / kBitsPerWord] >> (i % kBitsPerWord)) & 1))
+			{
+				DFSRecursiveBitset(
+					i, dfs_number_initial, visited_bits, visitor);
+			}
+		}
+
+		return;
+	}
 
-	TraversalResults<TV> traversal_results(
-		this->vertex_count, TraversalResultsType::DFS_RECURSIVE);
+	vector<bool> is_visited(this->vertex_count);
 
 	int dfs_number_initial = 0;
 
@@ -97,11 +275,9 @@ void AdjacencyMatrixGraph<TE, TV>::HostDFSRecursive() const
 	{
 		if (!is_visited[i])
 		{
-			DFSRecursive(i, dfs_number_initial, is_visited, traversal_results);
+			DFSRecursive(i, dfs_number_initial, is_visited, visitor);
 		}
 	}
-
-	TraversalResults<TV>::DisplayTraversalResults(traversal_results);
 }
 
 template<typename TE, typename TV>
@@ -109,48 +285,48 @@ void AdjacencyMatrixGraph<TE, TV>::DFSRecursive(
 	size_t current_vertex_index,
 	int& current_dfs_number,
 	vector<bool>& is_visited,
-	TraversalResults<TV>& traversal_results) const
+	TraversalVisitor<TE>& visitor) const
 {
-	is_visited[current_vertex_index] = true;
+	DSE_INSTRUMENT_COUNTERS("AdjacencyMatrixGraph::DFSRecursive");
+	DSE_INSTRUMENT_DEPTH();
+	DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
+	DSE_INSTRUMENT_ADD(EDGES_SCANNED, this->vertex_count);
 
-	traversal_results.traversal_numbers[current_vertex_index] =
-		format("([{0}]{1}:{2})",
-			current_vertex_index,
-			vertexes[current_vertex_index],
-			current_dfs_number++);
+	is_visited[current_vertex_index] = true;
 
-	traversal_results.traversal_list.emplace_back(
-		format("([{0}]{1})",
-			current_vertex_index, vertexes[current_vertex_index]));
+	visitor.OnVertexVisited(current_vertex_index, current_dfs_number++);
 
 	for (size_t i = 0; i < this->vertex_count; i++)
 	{
-		if (edges[current_vertex_index][i] != 0
-			&& edges[current_vertex_index][i] < infinity_cost_
+		if (GetCostRow(current_vertex_index)[i] != 0
+			&& GetCostRow(current_vertex_index)[i] < infinity_cost_
 			&& !is_visited[i])
 		{
-			traversal_results.spanning_tree_edges.emplace_back(
-				format("([{0}]{1}-[{2}]{3}@{4})",
-					current_vertex_index,
-					vertexes[current_vertex_index],
-					i,
-					vertexes[i],
-					edges[current_vertex_index][i]));
+			visitor.OnSpanningTreeEdge(
+				current_vertex_index,
+				i,
+				GetCostRow(current_vertex_index)[i]);
 
 			DFSRecursive(
 				i, current_dfs_number,
-				is_visited, traversal_results);
+				is_visited, visitor);
 		}
 	}
 }
 
 template<typename TE, typename TV>
-void AdjacencyMatrixGraph<TE, TV>::DFSIterative() const
+void AdjacencyMatrixGraph<TE, TV>::DFSIterative(
+	TraversalVisitor<TE>& visitor) const
 {
-	vector<bool> is_visited(this->vertex_count);
+	DSE_INSTRUMENT_SCOPE("AdjacencyMatrixGraph::DFSIterative");
 
-	TraversalResults<TV> traversal_results(
-		this->vertex_count, TraversalResultsType::DFS_ITERATIVE);
+	if (storage_mode_ != MatrixStorageMode::COST_MATRIX)
+	{
+		DFSIterativeBitset(visitor);
+		return;
+	}
+
+	vector<bool> is_visited(this->vertex_count);
 
 	stack<size_t> dfs_stack;
 
@@ -180,38 +356,31 @@ void AdjacencyMatrixGraph<TE, TV>::DFSIterative() const
 
 			is_visited[current_vertex_index] = true;
 
-			traversal_results.traversal_numbers[current_vertex_index] =
-				format("([{0}]{1}:{2})",
-					current_vertex_index,
-					vertexes[current_vertex_index],
-					current_dfs_number++);
+			DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
+			DSE_INSTRUMENT_ADD(EDGES_SCANNED, this->vertex_count);
 
-			traversal_results.traversal_list.emplace_back(format("([{0}]{1})",
-				current_vertex_index, vertexes[current_vertex_index]));
+			visitor.OnVertexVisited(current_vertex_index, current_dfs_number++);
 
 			for (size_t j = 0; j < this->vertex_count; j++)
 			{
-				if (edges[current_vertex_index][j] != 0
-					&& edges[current_vertex_index][j] < infinity_cost_
+				if (GetCostRow(current_vertex_index)[j] != 0
+					&& GetCostRow(current_vertex_index)[j] < infinity_cost_
 					&& !is_visited[j])
 				{
-					traversal_results.spanning_tree_edges.emplace_back(
-						format("([{0}]{1}-[{2}]{3}@{4})",
-							current_vertex_index,
-							vertexes[current_vertex_index],
-							j,
-							vertexes[j],
-							edges[current_vertex_index][j]));
+					visitor.OnSpanningTreeEdge(
+						current_vertex_index,
+						j,
+						GetCostRow(current_vertex_index)[j]);
 
 					// is_visited[j] = true;
 
 					dfs_stack.push(j);
+
+					DSE_INSTRUMENT_PEAK(PEAK_DEPTH, dfs_stack.size());
 				}
 			}
 		}
 	}
-
-	TraversalResults<TV>::DisplayTraversalResults(traversal_results);
 }
 
 template<typename TE, typename TV>
@@ -219,8 +388,10 @@ void AdjacencyMatrixGraph<TE, TV>::BFSImp(
 	size_t current_vertex_index,
 	int& current_bfs_number,
 	vector<bool>& is_visited,
-	TraversalResults<TV>& traversal_results) const
+	TraversalVisitor<TE>& visitor) const
 {
+	DSE_INSTRUMENT_COUNTERS("AdjacencyMatrixGraph::BFS");
+
 	queue<size_t> bfs_queue;
 
 	bfs_queue.push(current_vertex_index);
@@ -234,147 +405,1077 @@ void AdjacencyMatrixGraph<TE, TV>::BFSImp(
 		size_t current_vertex_index = bfs_queue.front();
 		bfs_queue.pop();
 
-		traversal_results.traversal_numbers[current_vertex_index] =
-			format("([{0}]{1}:{2})",
-				current_vertex_index,
-				vertexes[current_vertex_index],
-				current_bfs_number++);
+		DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
+		DSE_INSTRUMENT_ADD(EDGES_SCANNED, this->vertex_count);
 
-		traversal_results.traversal_list.emplace_back(format("([{0}]{1})",
-			current_vertex_index, vertexes[current_vertex_index]));
+		visitor.OnVertexVisited(current_vertex_index, current_bfs_number++);
 
 		for (size_t i = 0; i < this->vertex_count; i++)
 		{
-			if (edges[current_vertex_index][i] != 0
-				&& edges[current_vertex_index][i] < infinity_cost_
+			if (GetCostRow(current_vertex_index)[i] != 0
+				&& GetCostRow(current_vertex_index)[i] < infinity_cost_
 				&& !is_visited[i])
 			{
-				traversal_results.spanning_tree_edges.emplace_back(
-					format("([{0}]{1}-[{2}]{3}@{4})",
-						current_vertex_index,
-						vertexes[current_vertex_index],
-						i,
-						vertexes[i],
-						edges[current_vertex_index][i]));
+				visitor.OnSpanningTreeEdge(
+					current_vertex_index,
+					i,
+					GetCostRow(current_vertex_index)[i]);
 
 				is_visited[i] = true;
 
 				bfs_queue.push(i);
+
+				DSE_INSTRUMENT_PEAK(PEAK_DEPTH, bfs_queue.size());
 			}
 		}
 	}
 }
 
+template<typename TE, typename TV>
+size_t AdjacencyMatrixGraph<TE, TV>::GetCostStride(size_t vertex_count)
+{
+	if (kCostAlignment % sizeof(TE) != 0)
+	{
+		return vertex_count;
+	}
+
+	constexpr size_t kCostsPerAlignment = kCostAlignment / sizeof(TE);
+
+	return (vertex_count + kCostsPerAlignment - 1)
+		/ kCostsPerAlignment * kCostsPerAlignment;
+}
+
+template<typename TE, typename TV>
+const TE* AdjacencyMatrixGraph<TE, TV>::GetCostRow(size_t row_index) const
+{
+	return edges.data() + row_index * cost_stride_;
+}
+
+template<typename TE, typename TV>
+TE* AdjacencyMatrixGraph<TE, TV>::GetCostRow(size_t row_index)
+{
+	return edges.data() + row_index * cost_stride_;
+}
+
 template<typename TE, typename TV>
 void AdjacencyMatrixGraph<TE, TV>::BuildGraph(
 	const tuple<vector<TV>,
-	vector<vector<TE>>,
+	vector<TE>,
 	size_t,
-	const TE>& graph_data)
+	const TE>& graph_data,
+	MatrixStorageMode storage_mode)
 {
-	vertexes = get<0>(graph_data);
-	edges = get<1>(graph_data);
-	this->vertex_count = get<0>(graph_data).size();
-	this->edge_count = get<2>(graph_data);
-	infinity_cost_ = get<3>(graph_data);
+	BuildGraph(
+		span<const TV>(get<0>(graph_data)),
+		span<const TE>(get<1>(graph_data)),
+		get<0>(graph_data).size(),
+		get<2>(graph_data),
+		get<3>(graph_data),
+		storage_mode);
 }
 
 template<typename TE, typename TV>
-void AdjacencyMatrixGraph<TE, TV>::DisplayGraph() const
+void AdjacencyMatrixGraph<TE, TV>::BuildGraph(
+	span<const TV> vertex_data,
+	span<const TE> costs,
+	size_t source_stride,
+	size_t edge_count,
+	const TE& infinity_cost,
+	MatrixStorageMode storage_mode)
 {
-	cout << "[DISPLAYING ADJ-MATRIX GRAPH]" << endl;
-	cout << "   |";
-	for (size_t i = 0; i < this->vertex_count; i++)
+	DSE_INSTRUMENT_SCOPE("AdjacencyMatrixGraph::BuildGraph");
+
+	// ʱassignresizeŻ·
+	DSE_INSTRUMENT_ADD(ALLOCATIONS, vertexes.capacity() < vertex_data.size());
+	vertexes.assign(vertex_data.begin(), vertex_data.end());
+	this->vertex_count = vertex_data.size();
+	this->edge_count = edge_count;
+	infinity_cost_ = infinity_cost;
+	storage_mode_ = storage_mode;
+
+	if (source_stride == 0)
 	{
-		cout << format("{0:>3d}", i);
+		source_stride = this->vertex_count;
 	}
 
-	cout << endl;
+	words_per_row_ = (this->vertex_count + kBitsPerWord - 1) / kBitsPerWord;
+	edge_bits_.clear();
 
-	cout << string(3 + 1, '-');
-	cout << string(3 * this->vertex_count, '-') << endl;
+	if (storage_mode_ != MatrixStorageMode::COST_MATRIX)
+	{
+		DSE_INSTRUMENT_ADD(ALLOCATIONS,
+			edge_bits_.capacity() < this->vertex_count * words_per_row_);
+		edge_bits_.resize(this->vertex_count * words_per_row_);
 
-	for (size_t i = 0; i < this->vertex_count; i++)
+		for (size_t i = 0; i < this->vertex_count; i++)
+		{
+			const TE* source_row = costs.data() + i * source_stride;
+
+			for (size_t j = 0; j < this->vertex_count; j++)
+			{
+				if (source_row[j] != 0
+					&& source_row[j] < infinity_cost_)
+				{
+					edge_bits_[i * words_per_row_ + j / kBitsPerWord] |=
+						uint64_t(1) << (j % kBitsPerWord);
+				}
+			}
+		}
+	}
+
+	edges.clear();
+
+	if (storage_mode_ != MatrixStorageMode::BITSET_ONLY)
 	{
-		cout << format("{0:-3d}|", i);
+		cost_stride_ = GetCostStride(this->vertex_count);
+		DSE_INSTRUMENT_ADD(ALLOCATIONS, edges.capacity() < this->vertex_count * cost_stride_);
+		edges.assign(this->vertex_count * cost_stride_, infinity_cost_);
+
+		for (size_t i = 0; i < this->vertex_count; i++)
+		{
+			std::copy_n(
+				costs.data() + i * source_stride,
+				this->vertex_count,
+				GetCostRow(i));
+		}
+	}
+	else
+	{
+		cost_stride_ = 0;
+	}
+}
+
+template<typename TE, typename TV>
+TE AdjacencyMatrixGraph<TE, TV>::GetEdgeCost(
+	size_t begin_vertex_index, size_t end_vertex_index) const
+{
+	if (storage_mode_ != MatrixStorageMode::BITSET_ONLY)
+	{
+		return GetCostRow(begin_vertex_index)[end_vertex_index];
+	}
+
+	if ((edge_bits_[begin_vertex_index * words_per_row_
+		+ end_vertex_index / kBitsPerWord]
+		>> (end_vertex_index % kBitsPerWord)) & 1)
+	{
+		return 1;
+	}
+
+	return begin_vertex_index == end_vertex_index ? 0 : infinity_cost_;
+}
+
+template<typename TE, typename TV>
+void AdjacencyMatrixGraph<TE, TV>::SetEdge(
+	size_t begin_vertex_index, size_t end_vertex_index, const TE& cost)
+{
+	if (storage_mode_ != MatrixStorageMode::BITSET_ONLY)
+	{
+		GetCostRow(begin_vertex_index)[end_vertex_index] = cost;
+	}
+
+	if (storage_mode_ != MatrixStorageMode::COST_MATRIX)
+	{
+		uint64_t& current_word = edge_bits_[begin_vertex_index * words_per_row_
+			+ end_vertex_index / kBitsPerWord];
+		uint64_t current_bit = uint64_t(1) << (end_vertex_index % kBitsPerWord);
+
+		if (cost != 0 && cost < infinity_cost_)
+		{
+			current_word |= current_bit;
+		}
+		else
+		{
+			current_word &= ~current_bit;
+		}
+	}
+}
+
+template<typename TE, typename TV>
+void AdjacencyMatrixGraph<TE, TV>::GrowMatrix(size_t new_vertex_count)
+{
+	size_t old_vertex_count = this->vertex_count;
+	this->vertex_count = new_vertex_count;
 
-		for (auto& j : edges[i])
+	if (storage_mode_ != MatrixStorageMode::BITSET_ONLY)
+	{
+		// гʱչŲinfinity_cost_ֻ׷
+		if (new_vertex_count > cost_stride_)
 		{
-			if (j == infinity_cost_)
+			size_t new_cost_stride =
+				std::max(GetCostStride(new_vertex_count), 2 * cost_stride_);
+
+			decltype(edges) new_edges(new_vertex_count * new_cost_stride, infinity_cost_);
+
+			for (size_t i = 0; i < old_vertex_count; i++)
 			{
-				cout << format("{0:>3c}", '.');
+				std::copy_n(
+					GetCostRow(i),
+					cost_stride_,
+					new_edges.begin() + i * new_cost_stride);
 			}
-			else
+
+			edges.swap(new_edges);
+			cost_stride_ = new_cost_stride;
+		}
+		else
+		{
+			edges.resize(new_vertex_count * cost_stride_, infinity_cost_);
+		}
+
+		for (size_t i = old_vertex_count; i < new_vertex_count; i++)
+		{
+			GetCostRow(i)[i] = 0;
+		}
+	}
+
+	if (storage_mode_ != MatrixStorageMode::COST_MATRIX)
+	{
+		size_t needed_words_per_row =
+			(new_vertex_count + kBitsPerWord - 1) / kBitsPerWord;
+
+		if (needed_words_per_row > words_per_row_)
+		{
+			size_t new_words_per_row =
+				std::max(needed_words_per_row, 2 * words_per_row_);
+
+			vector<uint64_t> new_edge_bits(new_vertex_count * new_words_per_row);
+
+			for (size_t i = 0; i < old_vertex_count; i++)
 			{
-				cout << format("{0:>3d}", j);
+				std::copy_n(
+					edge_bits_.begin() + i * words_per_row_,
+					words_per_row_,
+					new_edge_bits.begin() + i * new_words_per_row);
 			}
+
+			edge_bits_.swap(new_edge_bits);
+			words_per_row_ = new_words_per_row;
 		}
+		else
+		{
+			edge_bits_.resize(new_vertex_count * words_per_row_);
+		}
+	}
+}
 
-		cout << endl;
+template<typename TE, typename TV>
+size_t AdjacencyMatrixGraph<TE, TV>::AddVertex(const TV& vertex_data)
+{
+	vertexes.push_back(vertex_data);
+
+	GrowMatrix(this->vertex_count + 1);
+
+	return this->vertex_count - 1;
+}
+
+template<typename TE, typename TV>
+size_t AdjacencyMatrixGraph<TE, TV>::AddVertexes(const vector<TV>& vertex_data)
+{
+	size_t first_vertex_index = this->vertex_count;
+
+	vertexes.insert(vertexes.end(), vertex_data.begin(), vertex_data.end());
+
+	GrowMatrix(this->vertex_count + vertex_data.size());
+
+	return first_vertex_index;
+}
+
+template<typename TE, typename TV>
+bool AdjacencyMatrixGraph<TE, TV>::AddEdge(
+	size_t begin_vertex_index,
+	size_t end_vertex_index,
+	const TE& cost,
+	bool is_directed)
+{
+	if (begin_vertex_index >= this->vertex_count
+		|| end_vertex_index >= this->vertex_count)
+	{
+		return false;
 	}
 
-	cout << endl;
+	if (cost == 0 || !(cost < infinity_cost_))
+	{
+		return false;
+	}
+
+	TE current_cost = GetEdgeCost(begin_vertex_index, end_vertex_index);
+	bool had_edge = current_cost != 0 && current_cost < infinity_cost_;
+
+	SetEdge(begin_vertex_index, end_vertex_index, cost);
+
+	if (!is_directed)
+	{
+		SetEdge(end_vertex_index, begin_vertex_index, cost);
+	}
+
+	current_cost = GetEdgeCost(begin_vertex_index, end_vertex_index);
+	bool has_edge = current_cost != 0 && current_cost < infinity_cost_;
+
+	if (has_edge && !had_edge)
+	{
+		this->edge_count++;
+	}
+	else if (!has_edge && had_edge)
+	{
+		this->edge_count--;
+	}
+
+	return true;
 }
 
 template<typename TE, typename TV>
-void AdjacencyMatrixGraph<TE, TV>::DFS(bool is_iterative) const
+bool AdjacencyMatrixGraph<TE, TV>::RemoveEdge(
+	size_t begin_vertex_index,
+	size_t end_vertex_index,
+	bool is_directed)
 {
-	if (is_iterative)
+	if (begin_vertex_index >= this->vertex_count
+		|| end_vertex_index >= this->vertex_count)
 	{
-		DFSIterative();
+		return false;
 	}
-	else
+
+	TE current_cost = GetEdgeCost(begin_vertex_index, end_vertex_index);
+
+	if (current_cost == 0 || current_cost >= infinity_cost_)
+	{
+		return false;
+	}
+
+	// Խ0ʾޱߣ뽨ͼݵԼһ
+	TE no_edge_cost = begin_vertex_index == end_vertex_index ? 0 : infinity_cost_;
+
+	SetEdge(begin_vertex_index, end_vertex_index, no_edge_cost);
+
+	if (!is_directed)
 	{
-		HostDFSRecursive();
+		SetEdge(end_vertex_index, begin_vertex_index, no_edge_cost);
 	}
+
+	this->edge_count--;
+
+	return true;
 }
 
 template<typename TE, typename TV>
-void AdjacencyMatrixGraph<TE, TV>::BFS() const
+uint64_t AdjacencyMatrixGraph<TE, TV>::GetEdgeMaskWord(
+	size_t row_index, size_t word_index) const
 {
-	vector<bool> is_visited(this->vertex_count);
+	if (storage_mode_ != MatrixStorageMode::COST_MATRIX)
+	{
+		return edge_bits_[row_index * words_per_row_ + word_index];
+	}
 
-	TraversalResults<TV> traversal_results(
-		this->vertex_count, TraversalResultsType::BFS);
+	const size_t column_begin = word_index * kBitsPerWord;
+	const size_t column_count = std::min(kBitsPerWord, this->vertex_count - column_begin);
+	const TE* costs = GetCostRow(row_index) + column_begin;
 
-	int bfs_number_initial = 0;
+	uint64_t edge_mask = 0;
+	size_t j = 0;
 
-	for (size_t i = 0; i < this->vertex_count; i++)
+#ifdef __AVX2__
+	if constexpr (std::is_same_v<TE, int>)
 	{
-		if (!is_visited[i])
+		const __m256i zero_vector = _mm256_setzero_si256();
+		const __m256i infinity_vector = _mm256_set1_epi32(infinity_cost_);
+
+		for (; j + 8 <= column_count; j += 8)
+		{
+			__m256i cost_vector =
+				_mm256_loadu_si256(reinterpret_cast<const __m256i*>(costs + j));
+			__m256i is_edge_vector = _mm256_andnot_si256(
+				_mm256_cmpeq_epi32(cost_vector, zero_vector),
+				_mm256_cmpgt_epi32(infinity_vector, cost_vector));
+
+			edge_mask |= uint64_t(static_cast<uint32_t>(
+				_mm256_movemask_ps(_mm256_castsi256_ps(is_edge_vector)))) << j;
+		}
+	}
+	else if constexpr (std::is_same_v<TE, float>)
+	{
+		const __m256 zero_vector = _mm256_setzero_ps();
+		const __m256 infinity_vector = _mm256_set1_ps(infinity_cost_);
+
+		for (; j + 8 <= column_count; j += 8)
 		{
-			BFSImp(i, bfs_number_initial, is_visited, traversal_results);
+			__m256 cost_vector = _mm256_loadu_ps(costs + j);
+			__m256 is_edge_vector = _mm256_and_ps(
+				_mm256_cmp_ps(cost_vector, zero_vector, _CMP_NEQ_UQ),
+				_mm256_cmp_ps(cost_vector, infinity_vector, _CMP_LT_OQ));
+
+			edge_mask |= uint64_t(static_cast<uint32_t>(
+				_mm256_movemask_ps(is_edge_vector))) << j;
 		}
 	}
+#endif
+
+	for (; j < column_count; j++)
+	{
+		edge_mask |= uint64_t(costs[j] != 0 && costs[j] < infinity_cost_) << j;
+	}
 
-	TraversalResults<TV>::DisplayTraversalResults(traversal_results);
+	return edge_mask;
 }
 
 template<typename TE, typename TV>
-auto AdjacencyMatrixGraph<TE, TV>::GetAdjacencyListGraphData() const
-->tuple<vector<TV>,
-	const vector<vector<pair<size_t, TE>>>,
-	size_t>
+size_t AdjacencyMatrixGraph<TE, TV>::FindNextUnvisitedAdjVertex(
+	size_t row_index,
+	size_t begin_column_index,
+	const vector<uint64_t>& visited_bits) const
 {
-	vector<vector<pair<size_t, TE>>> vex_adj_data;
+	size_t word_index = begin_column_index / kBitsPerWord;
 
-	for (auto& i : edges)
+	if (word_index >= words_per_row_)
 	{
-		vector<pair<size_t, TE>> current_vex_adj_data;
+		return this->vertex_count;
+	}
 
-		for (size_t j = 0; j < this->vertex_count; j++)
+	const uint64_t* row_bits = &edge_bits_[row_index * words_per_row_];
+
+	// ׸εbegin_column_index֮ǰĸλ
+	uint64_t candidate_bits = row_bits[word_index] & ~visited_bits[word_index]
+		& (~uint64_t(0) << (begin_column_index % kBitsPerWord));
+
+	while (candidate_bits == 0)
+	{
+		if (++word_index >= words_per_row_)
 		{
-			if (i[j] != 0 && i[j] < infinity_cost_)
-			{
-				current_vex_adj_data.emplace_back(j, i[j]);
-			}
+			return this->vertex_count;
 		}
 
-		vex_adj_data.emplace_back(std::move(current_vex_adj_data));
+		candidate_bits = row_bits[word_index] & ~visited_bits[word_index];
 	}
 
-	cout << "<CONVERTED FROM ADJ-MATRIX GRAPH TO ADJ-LIST GRAPH.>"
-		<< endl << endl;
+	return word_index * kBitsPerWord + countr_zero(candidate_bits);
+}
 
-	return make_tuple(vertexes, std::move(vex_adj_data), this->edge_count);
+template<typename TE, typename TV>
+void AdjacencyMatrixGraph<TE, TV>::DFSRecursiveBitset(
+	size_t current_vertex_index,
+	int& current_dfs_number,
+	vector<uint64_t>& visited_bits,
+	TraversalVisitor<TE>& visitor) const
+{
+	DSE_INSTRUMENT_COUNTERS("AdjacencyMatrixGraph::DFSRecursive");
+	DSE_INSTRUMENT_DEPTH();
+	DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
+
+	visited_bits[current_vertex_index / kBitsPerWord] |=
+		uint64_t(1) << (current_vertex_index % kBitsPerWord);
+
+	visitor.OnVertexVisited(current_vertex_index, current_dfs_number++);
+
+	// ÿεݹ鷵غʱǿѸı䣬˴ϴλ֮ɸѡ
+	for (size_t i = FindNextUnvisitedAdjVertex(
+		current_vertex_index, 0, visited_bits);
+		i < this->vertex_count;
+		i = FindNextUnvisitedAdjVertex(
+			current_vertex_index, i + 1, visited_bits))
+	{
+		visitor.OnSpanningTreeEdge(
+			current_vertex_index,
+			i,
+			GetEdgeCost(current_vertex_index, i));
+
+		DFSRecursiveBitset(i, current_dfs_number, visited_bits, visitor);
+	}
+}
+
+template<typename TE, typename TV>
+void AdjacencyMatrixGraph<TE, TV>::DFSIterativeBitset(
+	TraversalVisitor<TE>& visitor) const
+{
+	DSE_INSTRUMENT_COUNTERS("AdjacencyMatrixGraph::DFSIterative");
+
+	vector<uint64_t> visited_bits(words_per_row_);
+
+	stack<size_t> dfs_stack;
+
+	int current_dfs_number = 0;
+
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		if ((visited_bits[i / kBitsPerWord] >> (i % kBitsPerWord)) & 1)
+		{
+			continue;
+		}
+
+		dfs_stack.push(i);
+
+		while (!dfs_stack.empty())
+		{
+			size_t current_vertex_index = dfs_stack.top();
+			dfs_stack.pop();
+
+			uint64_t& current_visited_word =
+				visited_bits[current_vertex_index / kBitsPerWord];
+			const uint64_t current_vertex_bit =
+				uint64_t(1) << (current_vertex_index % kBitsPerWord);
+
+			if (current_visited_word & current_vertex_bit)
+			{
+				continue;
+			}
+
+			current_visited_word |= current_vertex_bit;
+
+			DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
+
+			visitor.OnVertexVisited(current_vertex_index, current_dfs_number++);
+
+			const uint64_t* row_bits =
+				&edge_bits_[current_vertex_index * words_per_row_];
+
+			for (size_t j = 0; j < words_per_row_; j++)
+			{
+				uint64_t candidate_bits = row_bits[j] & ~visited_bits[j];
+
+				while (candidate_bits)
+				{
+					size_t adj_vertex_index =
+						j * kBitsPerWord + countr_zero(candidate_bits);
+					// λ1
+					candidate_bits &= candidate_bits - 1;
+
+					visitor.OnSpanningTreeEdge(
+						current_vertex_index,
+						adj_vertex_index,
+						GetEdgeCost(current_vertex_index, adj_vertex_index));
+
+					dfs_stack.push(adj_vertex_index);
+
+					DSE_INSTRUMENT_PEAK(PEAK_DEPTH, dfs_stack.size());
+				}
+			}
+		}
+	}
+}
+
+template<typename TE, typename TV>
+void AdjacencyMatrixGraph<TE, TV>::DFSExplicitStackBitset(
+	TraversalVisitor<TE>& visitor) const
+{
+	DSE_INSTRUMENT_COUNTERS("AdjacencyMatrixGraph::DFSExplicitStack");
+
+	vector<uint64_t> visited_bits(words_per_row_);
+
+	// ÿһ֡Ϊ(±,һɸѡ±)
+	vector<pair<size_t, size_t>> dfs_stack;
+
+	int current_dfs_number = 0;
+
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		if ((visited_bits[i / kBitsPerWord] >> (i % kBitsPerWord)) & 1)
+		{
+			continue;
+		}
+
+		visited_bits[i / kBitsPerWord] |= uint64_t(1) << (i % kBitsPerWord);
+
+		DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
+
+		visitor.OnVertexVisited(i, current_dfs_number++);
+
+		dfs_stack.emplace_back(i, 0);
+
+		while (!dfs_stack.empty())
+		{
+			auto& [current_vertex_index, current_column_index] = dfs_stack.back();
+
+			const size_t adj_vertex_index = FindNextUnvisitedAdjVertex(
+				current_vertex_index, current_column_index, visited_bits);
+
+			if (adj_vertex_index >= this->vertex_count)
+			{
+				dfs_stack.pop_back();
+				continue;
+			}
+
+			// ƽαջ֡ջʹջ֡ʧЧ
+			current_column_index = adj_vertex_index + 1;
+
+			visitor.OnSpanningTreeEdge(
+				current_vertex_index,
+				adj_vertex_index,
+				GetEdgeCost(current_vertex_index, adj_vertex_index));
+
+			visited_bits[adj_vertex_index / kBitsPerWord] |=
+				uint64_t(1) << (adj_vertex_index % kBitsPerWord);
+
+			DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
+
+			visitor.OnVertexVisited(adj_vertex_index, current_dfs_number++);
+
+			dfs_stack.emplace_back(adj_vertex_index, 0);
+
+			DSE_INSTRUMENT_PEAK(PEAK_DEPTH, dfs_stack.size());
+		}
+	}
+}
+
+template<typename TE, typename TV>
+void AdjacencyMatrixGraph<TE, TV>::BFSBitsetImp(
+	size_t current_vertex_index,
+	int& current_bfs_number,
+	vector<uint64_t>& visited_bits,
+	size_t& unvisited_count,
+	TraversalVisitor<TE>& visitor) const
+{
+	DSE_INSTRUMENT_COUNTERS("AdjacencyMatrixGraph::BFS");
+
+	queue<size_t> bfs_queue;
+
+	bfs_queue.push(current_vertex_index);
+	visited_bits[current_vertex_index / kBitsPerWord] |=
+		uint64_t(1) << (current_vertex_index % kBitsPerWord);
+	unvisited_count--;
+
+	while (!bfs_queue.empty())
+	{
+		size_t current_vertex_index = bfs_queue.front();
+		bfs_queue.pop();
+
+		DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
+
+		visitor.OnVertexVisited(current_vertex_index, current_bfs_number++);
+
+		// жʱʣඥɨ
+		if (unvisited_count == 0)
+		{
+			continue;
+		}
+
+		const uint64_t* row_bits =
+			&edge_bits_[current_vertex_index * words_per_row_];
+
+		for (size_t i = 0; i < words_per_row_; i++)
+		{
+			uint64_t new_bits = row_bits[i] & ~visited_bits[i];
+
+			if (new_bits == 0)
+			{
+				continue;
+			}
+
+			// һԽеȫڽӶΪѷ
+			visited_bits[i] |= new_bits;
+			unvisited_count -= popcount(new_bits);
+
+			while (new_bits)
+			{
+				size_t adj_vertex_index = i * kBitsPerWord + countr_zero(new_bits);
+				new_bits &= new_bits - 1;
+
+				visitor.OnSpanningTreeEdge(
+					current_vertex_index,
+					adj_vertex_index,
+					GetEdgeCost(current_vertex_index, adj_vertex_index));
+
+				bfs_queue.push(adj_vertex_index);
+
+				DSE_INSTRUMENT_PEAK(PEAK_DEPTH, bfs_queue.size());
+			}
+		}
+	}
+}
+
+template<typename TE, typename TV>
+void AdjacencyMatrixGraph<TE, TV>::DisplayGraph() const
+{
+	cout << "[DISPLAYING ADJ-MATRIX GRAPH]" << endl;
+	cout << "   |";
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		cout << format("{0:>3d}", i);
+	}
+
+	cout << endl;
+
+	cout << string(3 + 1, '-');
+	cout << string(3 * this->vertex_count, '-') << endl;
+
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		cout << format("{0:-3d}|", i);
+
+		for (size_t j = 0; j < this->vertex_count; j++)
+		{
+			TE current_cost = GetEdgeCost(i, j);
+
+			if (current_cost == infinity_cost_)
+			{
+				cout << format("{0:>3c}", '.');
+			}
+			else
+			{
+				cout << format("{0:>3d}", current_cost);
+			}
+		}
+
+		cout << endl;
+	}
+
+	cout << endl;
+}
+
+template<typename TE, typename TV>
+const TV& AdjacencyMatrixGraph<TE, TV>::GetVertexData(size_t vertex_index) const
+{
+	return vertexes[vertex_index];
+}
+
+template<typename TE, typename TV>
+template<typename TFunc>
+void AdjacencyMatrixGraph<TE, TV>::ForEachAdjacentEdge(
+	size_t vertex_index, TFunc&& func) const
+{
+	const size_t word_count = (this->vertex_count + kBitsPerWord - 1) / kBitsPerWord;
+
+	for (size_t i = 0; i < word_count; i++)
+	{
+		for (uint64_t current_bits = GetEdgeMaskWord(vertex_index, i);
+			current_bits;
+			current_bits &= current_bits - 1)
+		{
+			size_t adj_vertex_index = i * kBitsPerWord + countr_zero(current_bits);
+
+			func(adj_vertex_index, GetEdgeCost(vertex_index, adj_vertex_index));
+		}
+	}
+}
+
+template<typename TE, typename TV>
+void AdjacencyMatrixGraph<TE, TV>::DFS(bool is_iterative) const
+{
+	TraversalResults<TE, TV> traversal_results(
+		this->vertex_count,
+		is_iterative ?
+		TraversalResultsType::DFS_ITERATIVE : TraversalResultsType::DFS_RECURSIVE);
+
+	DFS(is_iterative, traversal_results);
+
+	TraversalResults<TE, TV>::DisplayTraversalResults(traversal_results, *this);
+}
+
+template<typename TE, typename TV>
+void AdjacencyMatrixGraph<TE, TV>::DFS(
+	bool is_iterative, TraversalVisitor<TE>& visitor) const
+{
+	if (is_iterative)
+	{
+		DFSIterative(visitor);
+	}
+	else
+	{
+		HostDFSRecursive(visitor);
+	}
+}
+
+template<typename TE, typename TV>
+void AdjacencyMatrixGraph<TE, TV>::DFSExplicitStack() const
+{
+	TraversalResults<TE, TV> traversal_results(
+		this->vertex_count, TraversalResultsType::DFS_EXPLICIT_STACK);
+
+	DFSExplicitStack(traversal_results);
+
+	TraversalResults<TE, TV>::DisplayTraversalResults(traversal_results, *this);
+}
+
+template<typename TE, typename TV>
+void AdjacencyMatrixGraph<TE, TV>::DFSExplicitStack(
+	TraversalVisitor<TE>& visitor) const
+{
+	DSE_INSTRUMENT_SCOPE("AdjacencyMatrixGraph::DFSExplicitStack");
+
+	if (storage_mode_ != MatrixStorageMode::COST_MATRIX)
+	{
+		DFSExplicitStackBitset(visitor);
+		return;
+	}
+
+	vector<bool> is_visited(this->vertex_count);
+
+	// ÿһ֡Ϊ(±,һ±)
+	vector<pair<size_t, size_t>> dfs_stack;
+
+	int current_dfs_number = 0;
+
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		if (is_visited[i])
+		{
+			continue;
+		}
+
+		is_visited[i] = true;
+
+		DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
+		DSE_INSTRUMENT_ADD(EDGES_SCANNED, this->vertex_count);
+
+		visitor.OnVertexVisited(i, current_dfs_number++);
+
+		dfs_stack.emplace_back(i, 0);
+
+		while (!dfs_stack.empty())
+		{
+			auto& [current_vertex_index, current_column_index] = dfs_stack.back();
+
+			const TE* current_row = GetCostRow(current_vertex_index);
+
+			// ڵǰ֡ʣҵһδʵڽӶ
+			while (current_column_index < this->vertex_count
+				&& (current_row[current_column_index] == 0
+					|| current_row[current_column_index] >= infinity_cost_
+					|| is_visited[current_column_index]))
+			{
+				current_column_index++;
+			}
+
+			if (current_column_index == this->vertex_count)
+			{
+				dfs_stack.pop_back();
+				continue;
+			}
+
+			// ƽαջ֡ջʹջ֡ʧЧ
+			const size_t adj_vertex_index = current_column_index++;
+
+			visitor.OnSpanningTreeEdge(
+				current_vertex_index,
+				adj_vertex_index,
+				current_row[adj_vertex_index]);
+
+			is_visited[adj_vertex_index] = true;
+
+			DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
+			DSE_INSTRUMENT_ADD(EDGES_SCANNED, this->vertex_count);
+
+			visitor.OnVertexVisited(adj_vertex_index, current_dfs_number++);
+
+			dfs_stack.emplace_back(adj_vertex_index, 0);
+
+			DSE_INSTRUMENT_PEAK(PEAK_DEPTH, dfs_stack.size());
+		}
+	}
+}
+
+template<typename TE, typename TV>
+void AdjacencyMatrixGraph<TE, TV>::BFS() const
+{
+	TraversalResults<TE, TV> traversal_results(
+		this->vertex_count, TraversalResultsType::BFS);
+
+	BFS(traversal_results);
+
+	TraversalResults<TE, TV>::DisplayTraversalResults(traversal_results, *this);
+}
+
+template<typename TE, typename TV>
+void AdjacencyMatrixGraph<TE, TV>::BFS(TraversalVisitor<TE>& visitor) const
+{
+	DSE_INSTRUMENT_SCOPE("AdjacencyMatrixGraph::BFS");
+
+	if (storage_mode_ != MatrixStorageMode::COST_MATRIX)
+	{
+		vector<uint64_t> visited_bits(words_per_row_);
+		size_t unvisited_count = this->vertex_count;
+
+		int bfs_number_initial = 0;
+
+		for (size_t i = 0; i < this->vertex_count; i++)
+		{
+			if (!((visited_bits[i / kBitsPerWord] >> (i % kBitsPerWord)) & 1))
+			{
+				BFSBitsetImp(i, bfs_number_initial,
+					visited_bits, unvisited_count, visitor);
+			}
+		}
+
+		return;
+	}
+
+	vector<bool> is_visited(this->vertex_count);
+
+	int bfs_number_initial = 0;
+
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		if (!is_visited[i])
+		{
+			BFSImp(i, bfs_number_initial, is_visited, visitor);
+		}
+	}
+}
+
+template<typename TE, typename TV>
+AllPairsShortestPathResults<TE> AdjacencyMatrixGraph<TE, TV>::AllPairsShortestPaths(
+	ThreadPool* thread_pool) const
+{
+	const TE working_infinity = BlockedFloydWarshall::GetWorkingInfinity<TE>();
+
+	AllPairsShortestPathResults<TE> results;
+	results.vertex_count = this->vertex_count;
+	results.stride = BlockedFloydWarshall::GetPaddedStride(this->vertex_count);
+	results.infinity_cost = infinity_cost_;
+	results.distances.assign(results.stride * results.stride, working_infinity);
+
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		TE* row = &results.distances[i * results.stride];
+
+		for (size_t j = 0; j < this->vertex_count; j++)
+		{
+			TE current_cost = GetEdgeCost(i, j);
+
+			if (current_cost != 0 && current_cost < infinity_cost_)
+			{
+				row[j] = current_cost;
+			}
+		}
+
+		row[i] = 0;
+	}
+
+	BlockedFloydWarshall::Run(results.distances, results.stride, thread_pool);
+
+	// 벻СͼʱΪɴ
+	for (auto& i : results.distances)
+	{
+		if (!(i < infinity_cost_))
+		{
+			i = infinity_cost_;
+		}
+	}
+
+	return results;
+}
+
+template<typename TE, typename TV>
+vector<size_t> AdjacencyMatrixGraph<TE, TV>::ConnectedComponents(ThreadPool* thread_pool) const
+{
+	if (thread_pool != nullptr)
+	{
+		return ComponentLabeler::Parallel(*this, *thread_pool);
+	}
+
+	return ComponentLabeler::UnionFind(*this);
+}
+
+template<typename TE, typename TV>
+auto AdjacencyMatrixGraph<TE, TV>::GetAdjacencyListGraphData(
+	ThreadPool* thread_pool) const
+->tuple<vector<TV>,
+	const vector<vector<pair<size_t, TE>>>,
+	size_t>
+{
+	const size_t word_count = (this->vertex_count + kBitsPerWord - 1) / kBitsPerWord;
+
+	vector<vector<pair<size_t, TE>>> vex_adj_data(this->vertex_count);
+
+	// ÿλȷڽӱһηøеٰλд
+	auto convert_rows = [&](size_t, size_t chunk_begin, size_t chunk_end)
+	{
+		for (size_t i = chunk_begin; i < chunk_end; i++)
+		{
+			size_t adj_edge_count = 0;
+
+			for (size_t j = 0; j < word_count; j++)
+			{
+				adj_edge_count += popcount(GetEdgeMaskWord(i, j));
+			}
+
+			vex_adj_data[i].reserve(adj_edge_count);
+
+			ForEachAdjacentEdge(i, [&](size_t adj_vertex_index, const TE& cost)
+				{
+					vex_adj_data[i].emplace_back(adj_vertex_index, cost);
+				});
+		}
+	};
+
+	if (thread_pool != nullptr)
+	{
+		thread_pool->ParallelFor(0, this->vertex_count, convert_rows);
+	}
+	else
+	{
+		convert_rows(0, 0, this->vertex_count);
+	}
+
+	return make_tuple(vertexes, std::move(vex_adj_data), this->edge_count);
+}
+
+template<typename TE, typename TV>
+size_t AdjacencyMatrixGraph<TE, TV>::GetAdjacencyOffsets(
+	span<size_t> offsets, ThreadPool* thread_pool) const
+{
+	const size_t word_count = (this->vertex_count + kBitsPerWord - 1) / kBitsPerWord;
+
+	auto count_rows = [&](size_t, size_t chunk_begin, size_t chunk_end)
+	{
+		for (size_t i = chunk_begin; i < chunk_end; i++)
+		{
+			size_t adj_edge_count = 0;
+
+			for (size_t j = 0; j < word_count; j++)
+			{
+				adj_edge_count += popcount(GetEdgeMaskWord(i, j));
+			}
+
+			offsets[i + 1] = adj_edge_count;
+		}
+	};
+
+	offsets[0] = 0;
+
+	if (thread_pool != nullptr)
+	{
+		thread_pool->ParallelFor(0, this->vertex_count, count_rows);
+	}
+	else
+	{
+		count_rows(0, 0, this->vertex_count);
+	}
+
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		offsets[i + 1] += offsets[i];
+	}
+
+	return offsets[this->vertex_count];
+}
+
+template<typename TE, typename TV>
+void AdjacencyMatrixGraph<TE, TV>::ExportAdjacencyArrays(
+	span<const size_t> offsets,
+	span<size_t> adj_vertex_indexes,
+	span<TE> costs,
+	ThreadPool* thread_pool) const
+{
+	// дoffsetsĻص䣬ͬ
+	auto export_rows = [&](size_t, size_t chunk_begin, size_t chunk_end)
+	{
+		for (size_t i = chunk_begin; i < chunk_end; i++)
+		{
+			size_t current_position = offsets[i];
+
+			ForEachAdjacentEdge(i, [&](size_t adj_vertex_index, const TE& cost)
+				{
+					adj_vertex_indexes[current_position] = adj_vertex_index;
+					costs[current_position] = cost;
+					current_position++;
+				});
+		}
+	};
+
+	if (thread_pool != nullptr)
+	{
+		thread_pool->ParallelFor(0, this->vertex_count, export_rows);
+	}
+	else
+	{
+		export_rows(0, 0, this->vertex_count);
+	}
 }
\ No newline at end of file
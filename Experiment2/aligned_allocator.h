@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+// ֽķҪSIMD洢ʹ
+// ׼ԿջŻķʽ̳зʱ಻Ϊfinal
+// ģT: Ԫ; kAlignment: ֽΪ2ҲСalignof(T)
+template<typename T, size_t kAlignment>
+class AlignedAllocator
+{
+public:
+	using value_type = T;
+
+	// ʹvectorܵõͬͷ
+	template<typename TOther>
+	struct rebind
+	{
+		using other = AlignedAllocator<TOther, kAlignment>;
+	};
+
+	AlignedAllocator() = default;
+
+	template<typename TOther>
+	AlignedAllocator(const AlignedAllocator<TOther, kAlignment>&) {}
+
+	T* allocate(size_t count)
+	{
+		return static_cast<T*>(
+			::operator new(count * sizeof(T), std::align_val_t(kAlignment)));
+	}
+
+	void deallocate(T* pointer, size_t)
+	{
+		::operator delete(pointer, std::align_val_t(kAlignment));
+	}
+
+	template<typename TOther>
+	bool operator==(const AlignedAllocator<TOther, kAlignment>&) const
+	{
+		return true;
+	}
+};
@@ -0,0 +1,305 @@
+#pragma once
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <tuple>
+#include <span>
+#include <memory>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "csr_graph.h"
+#include "mapped_file.h"
+#include "graph_text_parser.h"
+
+using std::cout;
+using std::endl;
+using std::ofstream;
+using std::string;
+using std::vector;
+using std::tuple;
+using std::get;
+using std::span;
+using std::shared_ptr;
+using std::make_shared;
+using std::uint32_t;
+using std::uint64_t;
+
+// ͼļļͷ
+// ļͷ֮Ƕݡƫ顢ڽӶ±顢ȨĸΣ
+// εʼλþkSectionAlignmentֽڶ룬ֽƫƼ¼ļͷС
+// CSRGraphڴ沼ȫһ£˼ʱֻӳļCSRGraphͼָΡ
+struct BinaryGraphFileHeader
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t is_directed;
+	uint64_t vertex_count;
+	// ıʽиı
+	uint64_t edge_count;
+	// ڽӱĿͼÿ߶ӦĿ
+	uint64_t adjacency_count;
+	// дļĻsize_tTVTEԵֽʱݴ˾ܾݵļ
+	uint32_t index_size;
+	uint32_t vertex_data_size;
+	uint32_t cost_size;
+	uint32_t reserved;
+	uint64_t vertex_data_offset;
+	uint64_t offsets_offset;
+	uint64_t adj_vertex_indexes_offset;
+	uint64_t costs_offset;
+	uint64_t file_size;
+};
+
+// ͼļĶд
+// ԱģģTE: Ȩ; TV:ͣ߶ֽڸ
+class BinaryGraphFile final
+{
+private:
+	static constexpr char kMagic[8] = { 'D','S','E','G','R','A','P','H' };
+	static constexpr uint32_t kVersion = 1;
+	static constexpr uint64_t kSectionAlignment = 64;
+
+	static uint64_t AlignUp(uint64_t value);
+
+	// ʼoffsetcountelement_sizeֽԪصǷalignmentҲlimit
+	// Գ˷Ƚϣ
+	static bool IsSectionValid(
+		uint64_t offset,
+		uint64_t count,
+		uint64_t element_size,
+		uint64_t alignment,
+		uint64_t limit);
+
+	// дһΣǰֽ
+	static void WriteSection(
+		ofstream& output_stream,
+		uint64_t& current_position,
+		uint64_t section_offset,
+		const void* data,
+		uint64_t size);
+
+public:
+	// ̬ԱģWriteCSRGraphдΪͼļɹʱtrue
+	template<typename TE, typename TV>
+	static bool Write(
+		const string& file_name,
+		const CSRGraph<TE, TV>& graph,
+		bool is_directed);
+
+	// ̬ԱģLoadӳͼļgraphֱӳڴΪ洢
+	// is_directedļм¼ͼǷ򣬳ɹʱtrue
+	// ʱУļͷεķΧ룬Լƫ鵥ڽӶ±겻Խ磬
+	// 𻵻ضϵļfalse֮ıԽʡУ˳һƫڽ飬
+	// ʱΪO( + )κݡ
+	template<typename TE, typename TV>
+	static bool Load(const string& file_name, CSRGraph<TE, TV>& graph, bool& is_directed);
+
+	// ̬ԱģConvertFromTextGraphPresenterõıʽͼļ
+	// (Ƿ,,,,ߵ-յ-Ȩ)תΪͼļɹʱtrue
+	// ıGraphTextParserthread_poolΪʱн
+	template<typename TE, typename TV>
+	static bool ConvertFromText(
+		const string& text_file_name,
+		const string& binary_file_name,
+		ThreadPool* thread_pool = nullptr);
+};
+
+inline uint64_t BinaryGraphFile::AlignUp(uint64_t value)
+{
+	return (value + kSectionAlignment - 1) / kSectionAlignment * kSectionAlignment;
+}
+
+inline bool BinaryGraphFile::IsSectionValid(
+	uint64_t offset,
+	uint64_t count,
+	uint64_t element_size,
+	uint64_t alignment,
+	uint64_t limit)
+{
+	return offset % alignment == 0
+		&& offset <= limit
+		&& count <= (limit - offset) / element_size;
+}
+
+inline void BinaryGraphFile::WriteSection(
+	ofstream& output_stream,
+	uint64_t& current_position,
+	uint64_t section_offset,
+	const void* data,
+	uint64_t size)
+{
+	static const char kPadding[kSectionAlignment] = {};
+
+	output_stream.write(kPadding, section_offset - current_position);
+	output_stream.write(static_cast<const char*>(data), size);
+
+	current_position = section_offset + size;
+}
+
+template<typename TE, typename TV>
+bool BinaryGraphFile::Write(
+	const string& file_name,
+	const CSRGraph<TE, TV>& graph,
+	bool is_directed)
+{
+	static_assert(std::is_trivially_copyable_v<TE>
+		&& std::is_trivially_copyable_v<TV>,
+		"BinaryGraphFile requires trivially copyable TE and TV.");
+
+	auto csr_view = graph.GetCSRView();
+	auto& vertexes = get<0>(csr_view);
+	auto& offsets = get<1>(csr_view);
+	auto& adj_vertex_indexes = get<2>(csr_view);
+	auto& costs = get<3>(csr_view);
+
+	BinaryGraphFileHeader header = {};
+	std::memcpy(header.magic, kMagic, sizeof(kMagic));
+	header.version = kVersion;
+	header.is_directed = is_directed ? 1 : 0;
+	header.vertex_count = graph.vertex_count;
+	header.edge_count = graph.edge_count;
+	header.adjacency_count = adj_vertex_indexes.size();
+	header.index_size = sizeof(size_t);
+	header.vertex_data_size = sizeof(TV);
+	header.cost_size = sizeof(TE);
+
+	header.vertex_data_offset = AlignUp(sizeof(BinaryGraphFileHeader));
+	header.offsets_offset =
+		AlignUp(header.vertex_data_offset + vertexes.size_bytes());
+	header.adj_vertex_indexes_offset =
+		AlignUp(header.offsets_offset + offsets.size_bytes());
+	header.costs_offset =
+		AlignUp(header.adj_vertex_indexes_offset + adj_vertex_indexes.size_bytes());
+	header.file_size = header.costs_offset + costs.size_bytes();
+
+	ofstream output_stream(file_name, std::ios::out | std::ios::binary);
+
+	if (!output_stream.is_open())
+	{
+		return false;
+	}
+
+	output_stream.write(
+		reinterpret_cast<const char*>(&header), sizeof(BinaryGraphFileHeader));
+
+	uint64_t current_position = sizeof(BinaryGraphFileHeader);
+
+	WriteSection(output_stream, current_position,
+		header.vertex_data_offset, vertexes.data(), vertexes.size_bytes());
+	WriteSection(output_stream, current_position,
+		header.offsets_offset, offsets.data(), offsets.size_bytes());
+	WriteSection(output_stream, current_position,
+		header.adj_vertex_indexes_offset,
+		adj_vertex_indexes.data(), adj_vertex_indexes.size_bytes());
+	WriteSection(output_stream, current_position,
+		header.costs_offset, costs.data(), costs.size_bytes());
+
+	return static_cast<bool>(output_stream);
+}
+
+template<typename TE, typename TV>
+bool BinaryGraphFile::Load(
+	const string& file_name, CSRGraph<TE, TV>& graph, bool& is_directed)
+{
+	static_assert(std::is_trivially_copyable_v<TE>
+		&& std::is_trivially_copyable_v<TV>,
+		"BinaryGraphFile requires trivially copyable TE and TV.");
+
+	auto mapped_file = make_shared<MappedFile>();
+
+	if (!mapped_file->Open(file_name)
+		|| mapped_file->GetSize() < sizeof(BinaryGraphFileHeader))
+	{
+		return false;
+	}
+
+	const char* data = mapped_file->GetData();
+
+	BinaryGraphFileHeader header;
+	std::memcpy(&header, data, sizeof(BinaryGraphFileHeader));
+
+	// ƫռ(vertex_count + 1)size_tȻСļֽȾݴųvertex_count + 1
+	if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0
+		|| header.version != kVersion
+		|| header.index_size != sizeof(size_t)
+		|| header.vertex_data_size != sizeof(TV)
+		|| header.cost_size != sizeof(TE)
+		|| header.file_size > mapped_file->GetSize()
+		|| header.vertex_count >= header.file_size
+		|| !IsSectionValid(header.vertex_data_offset, header.vertex_count,
+			sizeof(TV), alignof(TV), header.offsets_offset)
+		|| !IsSectionValid(header.offsets_offset, header.vertex_count + 1,
+			sizeof(size_t), alignof(size_t), header.adj_vertex_indexes_offset)
+		|| !IsSectionValid(header.adj_vertex_indexes_offset, header.adjacency_count,
+			sizeof(size_t), alignof(size_t), header.costs_offset)
+		|| !IsSectionValid(header.costs_offset, header.adjacency_count,
+			sizeof(TE), alignof(TE), header.file_size))
+	{
+		return false;
+	}
+
+	span<const TV> vertexes(
+		reinterpret_cast<const TV*>(data + header.vertex_data_offset),
+		header.vertex_count);
+	span<const size_t> offsets(
+		reinterpret_cast<const size_t*>(data + header.offsets_offset),
+		header.vertex_count + 1);
+	span<const size_t> adj_vertex_indexes(
+		reinterpret_cast<const size_t*>(data + header.adj_vertex_indexes_offset),
+		header.adjacency_count);
+	span<const TE> costs(
+		reinterpret_cast<const TE*>(data + header.costs_offset),
+		header.adjacency_count);
+
+	// ӳʼַҳ룬ƫѰԪض룬ͼĵַ˶Ƕģ
+	// УCSRṹ֤֮ƫڽӶ±ʱԽ
+	if (offsets[0] != 0 || offsets[header.vertex_count] != header.adjacency_count)
+	{
+		return false;
+	}
+
+	for (size_t i = 0; i < header.vertex_count; i++)
+	{
+		if (offsets[i] > offsets[i + 1])
+		{
+			return false;
+		}
+	}
+
+	for (auto i : adj_vertex_indexes)
+	{
+		if (i >= header.vertex_count)
+		{
+			return false;
+		}
+	}
+
+	graph.BuildGraphFromView(
+		vertexes, offsets, adj_vertex_indexes, costs,
+		header.edge_count, std::move(mapped_file));
+
+	is_directed = header.is_directed != 0;
+
+	return true;
+}
+
+template<typename TE, typename TV>
+bool BinaryGraphFile::ConvertFromText(
+	const string& text_file_name,
+	const string& binary_file_name,
+	ThreadPool* thread_pool)
+{
+	CSRGraph<TE, TV> graph;
+	bool is_directed_graph = false;
+
+	if (!GraphTextParser::Parse(text_file_name, graph, is_directed_graph, thread_pool))
+	{
+		return false;
+	}
+
+	return Write(binary_file_name, graph, is_directed_graph);
+}
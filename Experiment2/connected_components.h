@@ -0,0 +1,191 @@
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <limits>
+#include <utility>
+
+#include "disjoint_set.h"
+#include "thread_pool.h"
+
+using std::vector;
+using std::atomic;
+using std::numeric_limits;
+
+// ͨ
+// ԱģṩForEachAdjacentEdgeԱģͼ
+// ַ߲ͼõͨ
+// صıŰС±˳0ʼţ
+// ͼı±0ʼνͨ˳һ£㷨Ľȫͬ
+class ComponentLabeler final
+{
+private:
+	// Ϊ̲߳鼯Ĳϲ
+	// ϲʱǰ±ϴĸҵ±Сĸ£CASȷǰǸ
+	// ˸ָָֻС±꣬ɻʱCAS·롣
+	static size_t ConcurrentFind(vector<atomic<size_t>>& parents, size_t element);
+
+	static void ConcurrentUnion(
+		vector<atomic<size_t>>& parents,
+		size_t first_element,
+		size_t second_element);
+
+	// ѸڼϵĴԪӳΪ0ʼ
+	template<typename TFind>
+	static vector<size_t> Relabel(size_t vertex_count, TFind&& find);
+
+public:
+	static constexpr size_t kNoLabel = numeric_limits<size_t>::max();
+
+	// ̬ԱģUnionFindб߽һ鲢鼯ϲظͨ
+	template<typename TGraph>
+	static vector<size_t> UnionFind(const TGraph& graph);
+
+	// ̬ԱģParallel̲߳еضԸԸĶڽӱ߽ϲ
+	// ظͨ
+	template<typename TGraph>
+	static vector<size_t> Parallel(const TGraph& graph, ThreadPool& thread_pool);
+
+	// ̬ԱGetComponentCountɱõͨ
+	static size_t GetComponentCount(const vector<size_t>& labels);
+};
+
+inline size_t ComponentLabeler::ConcurrentFind(
+	vector<atomic<size_t>>& parents, size_t element)
+{
+	while (true)
+	{
+		size_t parent = parents[element].load(std::memory_order_relaxed);
+
+		if (parent == element)
+		{
+			return element;
+		}
+
+		size_t grandparent = parents[parent].load(std::memory_order_relaxed);
+
+		if (parent != grandparent)
+		{
+			parents[element].compare_exchange_weak(
+				parent, grandparent, std::memory_order_relaxed);
+		}
+
+		element = grandparent;
+	}
+}
+
+inline void ComponentLabeler::ConcurrentUnion(
+	vector<atomic<size_t>>& parents,
+	size_t first_element,
+	size_t second_element)
+{
+	while (true)
+	{
+		size_t first_root = ConcurrentFind(parents, first_element);
+		size_t second_root = ConcurrentFind(parents, second_element);
+
+		if (first_root == second_root)
+		{
+			return;
+		}
+
+		if (first_root < second_root)
+		{
+			std::swap(first_root, second_root);
+		}
+
+		// first_rootΪ±ϴĸCASʧ˵ձ̹߳ҵ𴦣²
+		if (parents[first_root].compare_exchange_strong(
+			first_root, second_root, std::memory_order_relaxed))
+		{
+			return;
+		}
+	}
+}
+
+template<typename TFind>
+vector<size_t> ComponentLabeler::Relabel(size_t vertex_count, TFind&& find)
+{
+	vector<size_t> labels(vertex_count, kNoLabel);
+	// root_labels[r]ΪԪrڷı
+	vector<size_t> root_labels(vertex_count, kNoLabel);
+
+	size_t current_label = 0;
+
+	for (size_t i = 0; i < vertex_count; i++)
+	{
+		size_t root = find(i);
+
+		if (root_labels[root] == kNoLabel)
+		{
+			root_labels[root] = current_label++;
+		}
+
+		labels[i] = root_labels[root];
+	}
+
+	return labels;
+}
+
+template<typename TGraph>
+vector<size_t> ComponentLabeler::UnionFind(const TGraph& graph)
+{
+	DisjointSet disjoint_set(graph.vertex_count);
+
+	for (size_t i = 0; i < graph.vertex_count; i++)
+	{
+		graph.ForEachAdjacentEdge(i, [&](size_t adj_vertex_index, const auto&)
+			{
+				disjoint_set.Union(i, adj_vertex_index);
+			});
+	}
+
+	return Relabel(graph.vertex_count, [&](size_t vertex_index)
+		{
+			return disjoint_set.Find(vertex_index);
+		});
+}
+
+template<typename TGraph>
+vector<size_t> ComponentLabeler::Parallel(const TGraph& graph, ThreadPool& thread_pool)
+{
+	vector<atomic<size_t>> parents(graph.vertex_count);
+
+	for (size_t i = 0; i < graph.vertex_count; i++)
+	{
+		parents[i].store(i, std::memory_order_relaxed);
+	}
+
+	thread_pool.ParallelFor(0, graph.vertex_count,
+		[&](size_t, size_t chunk_begin, size_t chunk_end)
+		{
+			for (size_t i = chunk_begin; i < chunk_end; i++)
+			{
+				graph.ForEachAdjacentEdge(i, [&](size_t adj_vertex_index, const auto&)
+					{
+						ConcurrentUnion(parents, i, adj_vertex_index);
+					});
+			}
+		});
+
+	// ʱ߳̾ѽҲо
+	return Relabel(graph.vertex_count, [&](size_t vertex_index)
+		{
+			return ConcurrentFind(parents, vertex_index);
+		});
+}
+
+inline size_t ComponentLabeler::GetComponentCount(const vector<size_t>& labels)
+{
+	size_t component_count = 0;
+
+	for (auto i : labels)
+	{
+		if (i + 1 > component_count)
+		{
+			component_count = i + 1;
+		}
+	}
+
+	return component_count;
+}
@@ -0,0 +1,1075 @@
+#pragma once
+
+#include <iostream>
+#include <format>
+#include <string>
+#include <vector>
+#include <stack>
+#include <queue>
+#include <tuple>
+#include <utility>
+#include <span>
+#include <algorithm>
+#include <memory>
+
+#include "abstract_graph.h"
+#include "traversal_results.h"
+#include "connected_components.h"
+#include "thread_pool.h"
+#include "../Common/instrumentation.h"
+
+using std::cin;
+using std::cout;
+using std::endl;
+
+using std::format;
+
+using std::string;
+using std::vector;
+using std::stack;
+using std::queue;
+using std::pair;
+using std::tuple;
+using std::get;
+using std::make_tuple;
+using std::make_pair;
+using std::span;
+using std::shared_ptr;
+
+// ѹϡ(CSR)ʽʵֵͼ
+// жڽӱadj_vertex_indexescostsУ
+// iڽӱλ±[offsets[i], offsets[i + 1])ڡ
+// ڽӱֻ˳ɨ飬ָתߵĶѷ䡣
+// ֻͨͼʣͼȿָе
+// Ҳֱָⲿ洢ڴӳĶͼļ踴κݡ
+// CSRʽھֲ룬ɾʱһ飬ΪO( +  + ޸  )
+// Ӧʹ汾AddEdgesRemoveEdgesһύһ޸ģʹⲿ洢ʱ޸ǰȸΪ洢
+template<typename TE, typename TV>
+class CSRGraph final :public AbstractGraph<TE, TV>
+{
+private:
+	span<const TV> vertexes;
+	// Ϊvertex_count + 1ƫ
+	span<const size_t> offsets;
+	// ÿڽӱߵڽӶ±
+	span<const size_t> adj_vertex_indexes;
+	// ÿڽӱߵıȨadj_vertex_indexesһһӦ
+	span<const TE> costs;
+
+	// ɱеĴ洢ʹⲿ洢ʱΪ
+	vector<TV> owned_vertexes_;
+	vector<size_t> owned_offsets_;
+	vector<size_t> owned_adj_vertex_indexes_;
+	vector<TE> owned_costs_;
+
+	// ͼǷָⲿ洢BuildGraphFromViewλ
+	bool is_external_storage_ = false;
+	// ʹⲿ洢ʱ֤ⲿ洢ͼЧ߶
+	// ɵ÷б֤ⲿ洢ЧʱΪ
+	shared_ptr<const void> storage_owner_ = nullptr;
+
+	// ԱBindOwnedStorageͼָ򱾶еĴ洢
+	void BindOwnedStorage();
+
+	// ԱMakeStorageOwnedʹⲿ洢ʱ临ΪеĴ洢޸ͼ֮ǰ
+	void MakeStorageOwned();
+
+	void HostDFSRecursive(TraversalVisitor<TE>& visitor) const override;
+
+	void DFSRecursive(
+		size_t current_vertex_index,
+		int& current_dfs_number,
+		vector<bool>& is_visited,
+		TraversalVisitor<TE>& visitor) const override;
+
+	void DFSIterative(TraversalVisitor<TE>& visitor) const override;
+
+	void BFSImp(
+		size_t current_vertex_index,
+		int& current_bfs_number,
+		vector<bool>& is_visited,
+		TraversalVisitor<TE>& visitor) const override;
+
+public:
+	CSRGraph() = default;
+	~CSRGraph() = default;
+
+	// ͼָеƺָԭ˽ֹƣ
+	// ƶıݵַƶǰȫ
+	CSRGraph(const CSRGraph&) = delete;
+	CSRGraph& operator=(const CSRGraph&) = delete;
+	CSRGraph(CSRGraph&&) = default;
+	CSRGraph& operator=(CSRGraph&&) = default;
+
+	void DisplayGraph() const override;
+
+	const TV& GetVertexData(size_t vertex_index) const override;
+
+	void DFS(bool is_iterative) const override;
+
+	void DFS(bool is_iterative, TraversalVisitor<TE>& visitor) const override;
+
+	void DFSExplicitStack() const override;
+
+	void DFSExplicitStack(TraversalVisitor<TE>& visitor) const override;
+
+	void BFS() const override;
+
+	void BFS(TraversalVisitor<TE>& visitor) const override;
+
+	vector<size_t> ConnectedComponents(ThreadPool* thread_pool = nullptr) const override;
+
+	size_t AddVertex(const TV& vertex_data) override;
+
+	size_t AddVertexes(const vector<TV>& vertex_data) override;
+
+	// ɾߵȼֻһߵ
+	bool AddEdge(
+		size_t begin_vertex_index,
+		size_t end_vertex_index,
+		const TE& cost,
+		bool is_directed) override;
+
+	bool RemoveEdge(
+		size_t begin_vertex_index,
+		size_t end_vertex_index,
+		bool is_directed) override;
+
+	size_t AddEdges(
+		const vector<tuple<size_t, size_t, TE>>& edges,
+		bool is_directed) override;
+
+	size_t RemoveEdges(
+		const vector<pair<size_t, size_t>>& edges,
+		bool is_directed) override;
+
+	// ԱģForEachAdjacentEdgeڽ˳Ըÿڽӱߵ
+	// func(ڽӶ±, Ȩ)ڴ洢ʽͼ㷨ʹ
+	template<typename TFunc>
+	void ForEachAdjacentEdge(size_t vertex_index, TFunc&& func) const;
+
+	// ԱBuildGraphͼ
+	// graph_dataAdjacencyListGraph::BuildGraphĲʽͬ
+	// AdjacencyMatrixGraph::GetAdjacencyListGraphDataĽҲֱڽͼ
+	void BuildGraph(
+		const tuple<vector<TV>,
+		vector<vector<pair<size_t, TE>>>,
+		size_t>& graph_data);
+
+	// ԱBuildGraphڽӾʽݽͼ
+	// graph_dataAdjacencyMatrixGraph::BuildGraphĲʽͬ
+	void BuildGraph(
+		const tuple<vector<TV>,
+		vector<TE>,
+		size_t,
+		const TE>& graph_data);
+
+	// ԱBuildGraphֱѾźõCSR齨ͼ鱻
+	// offsetsΪ + 1adj_vertex_indexescostsΪoffsetsһԪ
+	void BuildGraph(
+		vector<TV>&& vertexes,
+		vector<size_t>&& offsets,
+		vector<size_t>&& adj_vertex_indexes,
+		vector<TE>&& costs,
+		size_t edge_count);
+
+	// ԱBuildGraphFromViewⲿ洢ΪͼĴ洢κ
+	// storage_ownerͼʹⲿ洢ڼ䱣Чڴӳļָ
+	void BuildGraphFromView(
+		span<const TV> vertexes,
+		span<const size_t> offsets,
+		span<const size_t> adj_vertex_indexes,
+		span<const TE> costs,
+		size_t edge_count,
+		shared_ptr<const void> storage_owner);
+
+	// ԱGetCSRViewȡ(,ƫ,ڽӶ±,Ȩ)ֻͼ
+	auto GetCSRView() const
+		->tuple<span<const TV>, span<const size_t>, span<const size_t>, span<const TE>>;
+
+	// ԱGetAdjacencyMatrixGraphData
+	// ȡڽӾʽǰͼAdjacencyMatrixGraphͶ
+	// BuildGraphԱĽͼ
+	// thread_poolΪʱ̳߳زд
+	auto GetAdjacencyMatrixGraphData(
+		const TE infinity_cost, ThreadPool* thread_pool = nullptr) const
+		->tuple<vector<TV>, vector<TE>, size_t, const TE>;
+
+	// ԱWriteAdjacencyMatrixAdjacencyListGraph::WriteAdjacencyMatrixͬ
+	// ڽӾд÷ԤȷáгΪstridecost_matrix
+	void WriteAdjacencyMatrix(
+		span<TE> cost_matrix,
+		size_t stride,
+		const TE& infinity_cost,
+		ThreadPool* thread_pool = nullptr) const;
+
+	// ԱGetAdjacencyListGraphData
+	// ȡڽӱʽǰͼAdjacencyListGraphͶ
+	// BuildGraphԱĽͼ
+	auto GetAdjacencyListGraphData() const
+		->tuple<vector<TV>,
+		const vector<vector<pair<size_t, TE>>>,
+		size_t>;
+};
+
+template<typename TE, typename TV>
+void CSRGraph<TE, TV>::BuildGraph(
+	const tuple<vector<TV>,
+	vector<vector<pair<size_t, TE>>>,
+	size_t>& graph_data)
+{
+	DSE_INSTRUMENT_SCOPE("CSRGraph::BuildGraph");
+
+	auto& vex_data = get<0>(graph_data);
+	auto& vex_adj_data = get<1>(graph_data);
+
+	this->vertex_count = vex_data.size();
+	this->edge_count = get<2>(graph_data);
+
+	// ʱơassignresizeŻ·
+	DSE_INSTRUMENT_ADD(ALLOCATIONS, owned_vertexes_.capacity() < vex_data.size());
+	owned_vertexes_ = vex_data;
+
+	// ͳڽӱһԷ洢ռ
+	DSE_INSTRUMENT_ADD(ALLOCATIONS, owned_offsets_.capacity() < this->vertex_count + 1);
+	owned_offsets_.assign(this->vertex_count + 1, 0);
+
+	for (size_t i = 0; i < vex_adj_data.size(); i++)
+	{
+		owned_offsets_[i + 1] = owned_offsets_[i] + vex_adj_data[i].size();
+	}
+
+	for (size_t i = vex_adj_data.size(); i < this->vertex_count; i++)
+	{
+		owned_offsets_[i + 1] = owned_offsets_[i];
+	}
+
+	DSE_INSTRUMENT_ADD(ALLOCATIONS,
+		owned_adj_vertex_indexes_.capacity() < owned_offsets_[this->vertex_count]);
+	owned_adj_vertex_indexes_.resize(owned_offsets_[this->vertex_count]);
+	DSE_INSTRUMENT_ADD(ALLOCATIONS, owned_costs_.capacity() < owned_offsets_[this->vertex_count]);
+	owned_costs_.resize(owned_offsets_[this->vertex_count]);
+
+	for (size_t i = 0; i < vex_adj_data.size(); i++)
+	{
+		size_t current_offset = owned_offsets_[i];
+
+		for (auto& j : vex_adj_data[i])
+		{
+			owned_adj_vertex_indexes_[current_offset] = j.first;
+			owned_costs_[current_offset] = j.second;
+			current_offset++;
+		}
+	}
+
+	BindOwnedStorage();
+}
+
+template<typename TE, typename TV>
+void CSRGraph<TE, TV>::BuildGraph(
+	const tuple<vector<TV>,
+	vector<TE>,
+	size_t,
+	const TE>& graph_data)
+{
+	DSE_INSTRUMENT_SCOPE("CSRGraph::BuildGraph");
+
+	auto& edges = get<1>(graph_data);
+	const TE infinity_cost = get<3>(graph_data);
+
+	this->vertex_count = get<0>(graph_data).size();
+	this->edge_count = get<2>(graph_data);
+
+	// ʱơassignresizeŻ·
+	DSE_INSTRUMENT_ADD(ALLOCATIONS, owned_vertexes_.capacity() < this->vertex_count);
+	owned_vertexes_ = get<0>(graph_data);
+
+	DSE_INSTRUMENT_ADD(ALLOCATIONS, owned_offsets_.capacity() < this->vertex_count + 1);
+	owned_offsets_.assign(this->vertex_count + 1, 0);
+
+	// һɨͳÿеЧڶɨ
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		const TE* current_row = &edges[i * this->vertex_count];
+		size_t current_row_count = 0;
+
+		for (size_t j = 0; j < this->vertex_count; j++)
+		{
+			if (current_row[j] != 0 && current_row[j] < infinity_cost)
+			{
+				current_row_count++;
+			}
+		}
+
+		owned_offsets_[i + 1] = owned_offsets_[i] + current_row_count;
+	}
+
+	DSE_INSTRUMENT_ADD(ALLOCATIONS,
+		owned_adj_vertex_indexes_.capacity() < owned_offsets_[this->vertex_count]);
+	owned_adj_vertex_indexes_.resize(owned_offsets_[this->vertex_count]);
+	DSE_INSTRUMENT_ADD(ALLOCATIONS, owned_costs_.capacity() < owned_offsets_[this->vertex_count]);
+	owned_costs_.resize(owned_offsets_[this->vertex_count]);
+
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		const TE* current_row = &edges[i * this->vertex_count];
+		size_t current_offset = owned_offsets_[i];
+
+		for (size_t j = 0; j < this->vertex_count; j++)
+		{
+			if (current_row[j] != 0 && current_row[j] < infinity_cost)
+			{
+				owned_adj_vertex_indexes_[current_offset] = j;
+				owned_costs_[current_offset] = current_row[j];
+				current_offset++;
+			}
+		}
+	}
+
+	BindOwnedStorage();
+}
+
+template<typename TE, typename TV>
+void CSRGraph<TE, TV>::BuildGraph(
+	vector<TV>&& vertexes,
+	vector<size_t>&& offsets,
+	vector<size_t>&& adj_vertex_indexes,
+	vector<TE>&& costs,
+	size_t edge_count)
+{
+	this->vertex_count = vertexes.size();
+	this->edge_count = edge_count;
+
+	owned_vertexes_ = std::move(vertexes);
+	owned_offsets_ = std::move(offsets);
+	owned_adj_vertex_indexes_ = std::move(adj_vertex_indexes);
+	owned_costs_ = std::move(costs);
+
+	BindOwnedStorage();
+}
+
+template<typename TE, typename TV>
+void CSRGraph<TE, TV>::BuildGraphFromView(
+	span<const TV> vertexes,
+	span<const size_t> offsets,
+	span<const size_t> adj_vertex_indexes,
+	span<const TE> costs,
+	size_t edge_count,
+	shared_ptr<const void> storage_owner)
+{
+	owned_vertexes_.clear();
+	owned_offsets_.clear();
+	owned_adj_vertex_indexes_.clear();
+	owned_costs_.clear();
+
+	this->vertexes = vertexes;
+	this->offsets = offsets;
+	this->adj_vertex_indexes = adj_vertex_indexes;
+	this->costs = costs;
+	storage_owner_ = std::move(storage_owner);
+	is_external_storage_ = true;
+
+	this->vertex_count = vertexes.size();
+	this->edge_count = edge_count;
+}
+
+template<typename TE, typename TV>
+void CSRGraph<TE, TV>::BindOwnedStorage()
+{
+	vertexes = owned_vertexes_;
+	offsets = owned_offsets_;
+	adj_vertex_indexes = owned_adj_vertex_indexes_;
+	costs = owned_costs_;
+	storage_owner_ = nullptr;
+	is_external_storage_ = false;
+}
+
+template<typename TE, typename TV>
+void CSRGraph<TE, TV>::MakeStorageOwned()
+{
+	if (is_external_storage_)
+	{
+		owned_vertexes_.assign(vertexes.begin(), vertexes.end());
+		owned_offsets_.assign(offsets.begin(), offsets.end());
+		owned_adj_vertex_indexes_.assign(
+			adj_vertex_indexes.begin(), adj_vertex_indexes.end());
+		owned_costs_.assign(costs.begin(), costs.end());
+	}
+
+	// δͼĶƫΪ
+	if (owned_offsets_.empty())
+	{
+		owned_offsets_.push_back(0);
+	}
+
+	BindOwnedStorage();
+}
+
+template<typename TE, typename TV>
+size_t CSRGraph<TE, TV>::AddVertex(const TV& vertex_data)
+{
+	MakeStorageOwned();
+
+	owned_vertexes_.push_back(vertex_data);
+	owned_offsets_.push_back(owned_offsets_.back());
+
+	BindOwnedStorage();
+
+	return this->vertex_count++;
+}
+
+template<typename TE, typename TV>
+size_t CSRGraph<TE, TV>::AddVertexes(const vector<TV>& vertex_data)
+{
+	MakeStorageOwned();
+
+	size_t first_vertex_index = this->vertex_count;
+
+	owned_vertexes_.insert(
+		owned_vertexes_.end(), vertex_data.begin(), vertex_data.end());
+	owned_offsets_.resize(
+		owned_offsets_.size() + vertex_data.size(), owned_offsets_.back());
+
+	BindOwnedStorage();
+
+	this->vertex_count += vertex_data.size();
+
+	return first_vertex_index;
+}
+
+template<typename TE, typename TV>
+bool CSRGraph<TE, TV>::AddEdge(
+	size_t begin_vertex_index,
+	size_t end_vertex_index,
+	const TE& cost,
+	bool is_directed)
+{
+	return AddEdges(
+		{ make_tuple(begin_vertex_index, end_vertex_index, cost) },
+		is_directed) == 1;
+}
+
+template<typename TE, typename TV>
+bool CSRGraph<TE, TV>::RemoveEdge(
+	size_t begin_vertex_index,
+	size_t end_vertex_index,
+	bool is_directed)
+{
+	return RemoveEdges(
+		{ make_pair(begin_vertex_index, end_vertex_index) },
+		is_directed) == 1;
+}
+
+template<typename TE, typename TV>
+size_t CSRGraph<TE, TV>::AddEdges(
+	const vector<tuple<size_t, size_t, TE>>& edges,
+	bool is_directed)
+{
+	MakeStorageOwned();
+
+	// Ѵڵıߣȳֵıߣֻ±Ȩı߰ݴ棬֮ԭڽӱ֮
+	vector<vector<pair<size_t, TE>>> appended_edges(this->vertex_count);
+	size_t added_count = 0;
+	size_t new_edge_count = 0;
+
+	// »ݴ(vertex_index,adj_vertex_index)ݴ±ʱtrue
+	auto set_edge = [&](size_t vertex_index, size_t adj_vertex_index, const TE& cost)
+	{
+		for (size_t i = owned_offsets_[vertex_index]; i < owned_offsets_[vertex_index + 1]; i++)
+		{
+			if (owned_adj_vertex_indexes_[i] == adj_vertex_index)
+			{
+				owned_costs_[i] = cost;
+
+				return false;
+			}
+		}
+
+		for (auto& i : appended_edges[vertex_index])
+		{
+			if (i.first == adj_vertex_index)
+			{
+				i.second = cost;
+
+				return false;
+			}
+		}
+
+		appended_edges[vertex_index].emplace_back(adj_vertex_index, cost);
+
+		return true;
+	};
+
+	for (auto& i : edges)
+	{
+		if (get<0>(i) >= this->vertex_count || get<1>(i) >= this->vertex_count)
+		{
+			continue;
+		}
+
+		if (set_edge(get<0>(i), get<1>(i), get<2>(i)))
+		{
+			new_edge_count++;
+		}
+
+		if (!is_directed)
+		{
+			set_edge(get<1>(i), get<0>(i), get<2>(i));
+		}
+
+		added_count++;
+	}
+
+	vector<size_t> new_offsets(this->vertex_count + 1, 0);
+
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		new_offsets[i + 1] = new_offsets[i]
+			+ owned_offsets_[i + 1] - owned_offsets_[i]
+			+ appended_edges[i].size();
+	}
+
+	vector<size_t> new_adj_vertex_indexes(new_offsets[this->vertex_count]);
+	vector<TE> new_costs(new_offsets[this->vertex_count]);
+	// ԭеڽӱ߱ǰıν
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		size_t position = std::copy(
+			owned_adj_vertex_indexes_.begin() + owned_offsets_[i],
+			owned_adj_vertex_indexes_.begin() + owned_offsets_[i + 1],
+			new_adj_vertex_indexes.begin() + new_offsets[i])
+			- new_adj_vertex_indexes.begin();
+
+		std::copy(
+			owned_costs_.begin() + owned_offsets_[i],
+			owned_costs_.begin() + owned_offsets_[i + 1],
+			new_costs.begin() + new_offsets[i]);
+
+		for (auto& j : appended_edges[i])
+		{
+			new_adj_vertex_indexes[position] = j.first;
+			new_costs[position] = j.second;
+			position++;
+		}
+	}
+
+	owned_offsets_ = std::move(new_offsets);
+	owned_adj_vertex_indexes_ = std::move(new_adj_vertex_indexes);
+	owned_costs_ = std::move(new_costs);
+
+	BindOwnedStorage();
+
+	this->edge_count += new_edge_count;
+
+	return added_count;
+}
+
+template<typename TE, typename TV>
+size_t CSRGraph<TE, TV>::RemoveEdges(
+	const vector<pair<size_t, size_t>>& edges,
+	bool is_directed)
+{
+	MakeStorageOwned();
+
+	vector<bool> is_removed(owned_adj_vertex_indexes_.size());
+
+	// ڸڽӱвҲǵһδɾġͨadj_vertex_indexı
+	auto mark_removed = [&](size_t vertex_index, size_t adj_vertex_index)
+	{
+		for (size_t i = owned_offsets_[vertex_index];
+			i < owned_offsets_[vertex_index + 1];
+			i++)
+		{
+			if (!is_removed[i] && owned_adj_vertex_indexes_[i] == adj_vertex_index)
+			{
+				is_removed[i] = true;
+				return true;
+			}
+		}
+
+		return false;
+	};
+
+	size_t removed_count = 0;
+
+	for (auto& i : edges)
+	{
+		if (i.first >= this->vertex_count
+			|| i.second >= this->vertex_count
+			|| !mark_removed(i.first, i.second))
+		{
+			continue;
+		}
+
+		if (!is_directed)
+		{
+			mark_removed(i.second, i.first);
+		}
+
+		removed_count++;
+	}
+
+	// ԭѹдλܲȡλ
+	size_t write_position = 0;
+
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		size_t read_begin = owned_offsets_[i];
+		size_t read_end = owned_offsets_[i + 1];
+
+		owned_offsets_[i] = write_position;
+
+		for (size_t j = read_begin; j < read_end; j++)
+		{
+			if (!is_removed[j])
+			{
+				owned_adj_vertex_indexes_[write_position] = owned_adj_vertex_indexes_[j];
+				owned_costs_[write_position] = owned_costs_[j];
+				write_position++;
+			}
+		}
+	}
+
+	owned_offsets_[this->vertex_count] = write_position;
+	owned_adj_vertex_indexes_.resize(write_position);
+	owned_costs_.resize(write_position);
+
+	BindOwnedStorage();
+
+	this->edge_count -= removed_count;
+
+	return removed_count;
+}
+
+template<typename TE, typename TV>
+vector<size_t> CSRGraph<TE, TV>::ConnectedComponents(ThreadPool* thread_pool) const
+{
+	if (thread_pool != nullptr)
+	{
+		return ComponentLabeler::Parallel(*this, *thread_pool);
+	}
+
+	return ComponentLabeler::UnionFind(*this);
+}
+
+template<typename TE, typename TV>
+auto CSRGraph<TE, TV>::GetCSRView() const
+	->tuple<span<const TV>, span<const size_t>, span<const size_t>, span<const TE>>
+{
+	return make_tuple(vertexes, offsets, adj_vertex_indexes, costs);
+}
+
+template<typename TE, typename TV>
+void CSRGraph<TE, TV>::DisplayGraph() const
+{
+	cout << "[DISPLAYING CSR GRAPH]" << endl;
+
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		cout << format("{0}: {1} ", i, vertexes[i]);
+
+		for (size_t j = offsets[i]; j < offsets[i + 1]; j++)
+		{
+			cout << format("([{0}]{1}@{2}) ",
+				adj_vertex_indexes[j],
+				vertexes[adj_vertex_indexes[j]],
+				costs[j]);
+		}
+
+		cout << endl;
+	}
+
+	cout << endl;
+}
+
+template<typename TE, typename TV>
+const TV& CSRGraph<TE, TV>::GetVertexData(size_t vertex_index) const
+{
+	return vertexes[vertex_index];
+}
+
+template<typename TE, typename TV>
+template<typename TFunc>
+void CSRGraph<TE, TV>::ForEachAdjacentEdge(
+	size_t vertex_index, TFunc&& func) const
+{
+	for (size_t i = offsets[vertex_index]; i < offsets[vertex_index + 1]; i++)
+	{
+		func(adj_vertex_indexes[i], costs[i]);
+	}
+}
+
+template<typename TE, typename TV>
+void CSRGraph<TE, TV>::DFS(bool is_iterative) const
+{
+	TraversalResults<TE, TV> traversal_results(
+		this->vertex_count,
+		is_iterative ?
+		TraversalResultsType::DFS_ITERATIVE : TraversalResultsType::DFS_RECURSIVE);
+
+	DFS(is_iterative, traversal_results);
+
+	TraversalResults<TE, TV>::DisplayTraversalResults(traversal_results, *this);
+}
+
+template<typename TE, typename TV>
+void CSRGraph<TE, TV>::DFS(
+	bool is_iterative, TraversalVisitor<TE>& visitor) const
+{
+	if (is_iterative)
+	{
+		DFSIterative(visitor);
+	}
+	else
+	{
+		HostDFSRecursive(visitor);
+	}
+}
+
+template<typename TE, typename TV>
+void CSRGraph<TE, TV>::HostDFSRecursive(
+	TraversalVisitor<TE>& visitor) const
+{
+	DSE_INSTRUMENT_SCOPE("CSRGraph::DFSRecursive");
+
+	vector<bool> is_visited(this->vertex_count);
+
+	int dfs_number_initial = 0;
+
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		if (!is_visited[i])
+		{
+			DFSRecursive(i, dfs_number_initial, is_visited, visitor);
+		}
+	}
+}
+
+template<typename TE, typename TV>
+void CSRGraph<TE, TV>::DFSRecursive(
+	size_t current_vertex_index,
+	int& current_dfs_number,
+	vector<bool>& is_visited,
+	TraversalVisitor<TE>& visitor) const
+{
+	DSE_INSTRUMENT_COUNTERS("CSRGraph::DFSRecursive");
+	DSE_INSTRUMENT_DEPTH();
+	DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
+	DSE_INSTRUMENT_ADD(EDGES_SCANNED,
+		offsets[current_vertex_index + 1] - offsets[current_vertex_index]);
+
+	is_visited[current_vertex_index] = true;
+
+	visitor.OnVertexVisited(current_vertex_index, current_dfs_number++);
+
+	for (size_t i = offsets[current_vertex_index];
+		i < offsets[current_vertex_index + 1];
+		i++)
+	{
+		if (!is_visited[adj_vertex_indexes[i]])
+		{
+			visitor.OnSpanningTreeEdge(
+				current_vertex_index,
+				adj_vertex_indexes[i],
+				costs[i]);
+
+			DFSRecursive(
+				adj_vertex_indexes[i], current_dfs_number,
+				is_visited, visitor);
+		}
+	}
+}
+
+template<typename TE, typename TV>
+void CSRGraph<TE, TV>::DFSIterative(
+	TraversalVisitor<TE>& visitor) const
+{
+	DSE_INSTRUMENT_SCOPE("CSRGraph::DFSIterative");
+
+	vector<bool> is_visited(this->vertex_count);
+
+	stack<size_t> dfs_stack;
+
+	int current_dfs_number = 0;
+
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		if (is_visited[i])
+		{
+			continue;
+		}
+
+		dfs_stack.push(i);
+
+		// ÿνѭջԪضӦδǷʹ
+		// šСΪ߼¼
+		while (!dfs_stack.empty())
+		{
+			size_t current_vertex_index = dfs_stack.top();
+			dfs_stack.pop();
+
+			if (is_visited[current_vertex_index])
+			{
+				continue;
+			}
+
+			is_visited[current_vertex_index] = true;
+
+			DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
+			DSE_INSTRUMENT_ADD(EDGES_SCANNED,
+				offsets[current_vertex_index + 1] - offsets[current_vertex_index]);
+
+			visitor.OnVertexVisited(current_vertex_index, current_dfs_number++);
+
+			for (size_t j = offsets[current_vertex_index];
+				j < offsets[current_vertex_index + 1];
+				j++)
+			{
+				if (!is_visited[adj_vertex_indexes[j]])
+				{
+					visitor.OnSpanningTreeEdge(
+						current_vertex_index,
+						adj_vertex_indexes[j],
+						costs[j]);
+
+					dfs_stack.push(adj_vertex_indexes[j]);
+
+					DSE_INSTRUMENT_PEAK(PEAK_DEPTH, dfs_stack.size());
+				}
+			}
+		}
+	}
+}
+
+template<typename TE, typename TV>
+void CSRGraph<TE, TV>::DFSExplicitStack() const
+{
+	TraversalResults<TE, TV> traversal_results(
+		this->vertex_count, TraversalResultsType::DFS_EXPLICIT_STACK);
+
+	DFSExplicitStack(traversal_results);
+
+	TraversalResults<TE, TV>::DisplayTraversalResults(traversal_results, *this);
+}
+
+template<typename TE, typename TV>
+void CSRGraph<TE, TV>::DFSExplicitStack(
+	TraversalVisitor<TE>& visitor) const
+{
+	DSE_INSTRUMENT_SCOPE("CSRGraph::DFSExplicitStack");
+
+	vector<bool> is_visited(this->vertex_count);
+
+	// ÿһ֡Ϊ(±,һڽӱڽе±)
+	vector<pair<size_t, size_t>> dfs_stack;
+
+	int current_dfs_number = 0;
+
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		if (is_visited[i])
+		{
+			continue;
+		}
+
+		is_visited[i] = true;
+
+		DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
+		DSE_INSTRUMENT_ADD(EDGES_SCANNED, offsets[i + 1] - offsets[i]);
+
+		visitor.OnVertexVisited(i, current_dfs_number++);
+
+		dfs_stack.emplace_back(i, offsets[i]);
+
+		while (!dfs_stack.empty())
+		{
+			auto& [current_vertex_index, current_edge_index] = dfs_stack.back();
+
+			const size_t edge_end = offsets[current_vertex_index + 1];
+
+			// ڵǰ֡ʣڽӱҵһδʵڽӶ
+			while (current_edge_index < edge_end
+				&& is_visited[adj_vertex_indexes[current_edge_index]])
+			{
+				current_edge_index++;
+			}
+
+			if (current_edge_index == edge_end)
+			{
+				dfs_stack.pop_back();
+				continue;
+			}
+
+			// ƽαջ֡ջʹջ֡ʧЧ
+			const size_t edge_index = current_edge_index++;
+			const size_t adj_vertex_index = adj_vertex_indexes[edge_index];
+
+			visitor.OnSpanningTreeEdge(
+				current_vertex_index, adj_vertex_index, costs[edge_index]);
+
+			is_visited[adj_vertex_index] = true;
+
+			DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
+			DSE_INSTRUMENT_ADD(EDGES_SCANNED,
+				offsets[adj_vertex_index + 1] - offsets[adj_vertex_index]);
+
+			visitor.OnVertexVisited(adj_vertex_index, current_dfs_number++);
+
+			dfs_stack.emplace_back(adj_vertex_index, offsets[adj_vertex_index]);
+
+			DSE_INSTRUMENT_PEAK(PEAK_DEPTH, dfs_stack.size());
+		}
+	}
+}
+
+template<typename TE, typename TV>
+void CSRGraph<TE, TV>::BFS() const
+{
+	TraversalResults<TE, TV> traversal_results(
+		this->vertex_count, TraversalResultsType::BFS);
+
+	BFS(traversal_results);
+
+	TraversalResults<TE, TV>::DisplayTraversalResults(traversal_results, *this);
+}
+
+template<typename TE, typename TV>
+void CSRGraph<TE, TV>::BFS(TraversalVisitor<TE>& visitor) const
+{
+	DSE_INSTRUMENT_SCOPE("CSRGraph::BFS");
+
+	vector<bool> is_visited(this->vertex_count);
+
+	int bfs_number_initial = 0;
+
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		if (!is_visited[i])
+		{
+			BFSImp(i, bfs_number_initial, is_visited, visitor);
+		}
+	}
+}
+
+template<typename TE, typename TV>
+void CSRGraph<TE, TV>::BFSImp(
+	size_t current_vertex_index,
+	int& current_bfs_number,
+	vector<bool>& is_visited,
+	TraversalVisitor<TE>& visitor) const
+{
+	DSE_INSTRUMENT_COUNTERS("CSRGraph::BFS");
+
+	queue<size_t> bfs_queue;
+
+	bfs_queue.push(current_vertex_index);
+	is_visited[current_vertex_index] = true;
+
+	// ÿνѭԪضӦѱǷʹ
+	// šСΪ߼¼
+	// ΪѷʱɣԭͬAdjacencyListGraph::BFSImp
+	while (!bfs_queue.empty())
+	{
+		size_t current_vertex_index = bfs_queue.front();
+		bfs_queue.pop();
+
+		DSE_INSTRUMENT_ADD(VERTEXES_VISITED, 1);
+		DSE_INSTRUMENT_ADD(EDGES_SCANNED,
+			offsets[current_vertex_index + 1] - offsets[current_vertex_index]);
+
+		visitor.OnVertexVisited(current_vertex_index, current_bfs_number++);
+
+		for (size_t i = offsets[current_vertex_index];
+			i < offsets[current_vertex_index + 1];
+			i++)
+		{
+			if (!is_visited[adj_vertex_indexes[i]])
+			{
+				visitor.OnSpanningTreeEdge(
+					current_vertex_index,
+					adj_vertex_indexes[i],
+					costs[i]);
+
+				is_visited[adj_vertex_indexes[i]] = true;
+
+				bfs_queue.push(adj_vertex_indexes[i]);
+
+				DSE_INSTRUMENT_PEAK(PEAK_DEPTH, bfs_queue.size());
+			}
+		}
+	}
+}
+
+template<typename TE, typename TV>
+auto CSRGraph<TE, TV>::GetAdjacencyMatrixGraphData(
+	const TE infinity_cost, ThreadPool* thread_pool) const
+	->tuple<vector<TV>, vector<TE>, size_t, const TE>
+{
+	vector<TE> result_edges(this->vertex_count * this->vertex_count);
+
+	WriteAdjacencyMatrix(result_edges, this->vertex_count, infinity_cost, thread_pool);
+
+	return make_tuple(
+		vector<TV>(vertexes.begin(), vertexes.end()),
+		std::move(result_edges),
+		this->edge_count, infinity_cost);
+}
+
+template<typename TE, typename TV>
+void CSRGraph<TE, TV>::WriteAdjacencyMatrix(
+	span<TE> cost_matrix,
+	size_t stride,
+	const TE& infinity_cost,
+	ThreadPool* thread_pool) const
+{
+	// лص·дڽӱ
+	auto write_rows = [&](size_t, size_t chunk_begin, size_t chunk_end)
+	{
+		for (size_t i = chunk_begin; i < chunk_end; i++)
+		{
+			TE* current_row = cost_matrix.data() + i * stride;
+
+			std::fill_n(current_row, this->vertex_count, infinity_cost);
+
+			for (size_t j = offsets[i]; j < offsets[i + 1]; j++)
+			{
+				current_row[adj_vertex_indexes[j]] = costs[j];
+			}
+
+			current_row[i] = 0;
+		}
+	};
+
+	if (thread_pool != nullptr)
+	{
+		thread_pool->ParallelFor(0, this->vertex_count, write_rows);
+	}
+	else
+	{
+		write_rows(0, 0, this->vertex_count);
+	}
+}
+
+template<typename TE, typename TV>
+auto CSRGraph<TE, TV>::GetAdjacencyListGraphData() const
+->tuple<vector<TV>,
+	const vector<vector<pair<size_t, TE>>>,
+	size_t>
+{
+	vector<vector<pair<size_t, TE>>> vex_adj_data(this->vertex_count);
+
+	for (size_t i = 0; i < this->vertex_count; i++)
+	{
+		vex_adj_data[i].reserve(offsets[i + 1] - offsets[i]);
+
+		for (size_t j = offsets[i]; j < offsets[i + 1]; j++)
+		{
+			vex_adj_data[i].emplace_back(adj_vertex_indexes[j], costs[j]);
+		}
+	}
+
+	return make_tuple(
+		vector<TV>(vertexes.begin(), vertexes.end()),
+		std::move(vex_adj_data),
+		this->edge_count);
+}
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+
+#include "traversal_results.h"
+
+using std::vector;
+
+// ŻԶ/ԵϻϣĹȱ
+// ģTE: Ȩ
+// ʱṩForEachAdjacentEdgeԱģͼиƳ洢
+// ߱߱˺ɶͬһͼ
+// УǰؽСʱԶչǰضĳߣǰظͼĴ󲿷ֱʱ
+// ΪԵϣÿδʶѰһλǰеĸ㣬ҵֹͣ
+// Űη䣬Ϊÿ㱻ʱɵıߣTraversalResultsеĶһ£
+// ʹԶʱͼBFSȫͬԵϵĲУ㰴±˳š
+template<typename TE>
+class DirectionOptimizingBFS final
+{
+private:
+	size_t vertex_count_ = 0;
+
+	// ߱iĳλ[out_offsets_[i], out_offsets_[i + 1])
+	vector<size_t> out_offsets_;
+	vector<size_t> out_vertex_indexes_;
+	vector<TE> out_costs_;
+
+	// ߱iλ[in_offsets_[i], in_offsets_[i + 1])
+	vector<size_t> in_offsets_;
+	vector<size_t> in_vertex_indexes_;
+	vector<TE> in_costs_;
+
+	// лֵBeamerķŻBFSͬ
+	// ǰس > δʶ / alpha_ ʱлΪԵϣ
+	// ǰض <  / beta_ ʱлԶ¡
+	size_t alpha_ = 15;
+	size_t beta_ = 18;
+
+	// root_vertex_indexʼڵͨб
+	void BFSImp(
+		size_t root_vertex_index,
+		int& current_bfs_number,
+		vector<bool>& is_visited,
+		size_t& unvisited_edge_count,
+		TraversalVisitor<TE>& visitor) const;
+
+public:
+	template<typename TGraph>
+	explicit DirectionOptimizingBFS(const TGraph& graph);
+
+	~DirectionOptimizingBFS() = default;
+
+	// ԱSetThresholdsлֵ
+	void SetThresholds(size_t alpha, size_t beta);
+
+	// ԱBFSͼйȱѭͼBFSͬ
+	void BFS(TraversalVisitor<TE>& visitor) const;
+};
+
+template<typename TE>
+template<typename TGraph>
+DirectionOptimizingBFS<TE>::DirectionOptimizingBFS(const TGraph& graph) :
+	vertex_count_(graph.vertex_count)
+{
+	out_offsets_.assign(vertex_count_ + 1, 0);
+	in_offsets_.assign(vertex_count_ + 1, 0);
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		graph.ForEachAdjacentEdge(i, [&](size_t adj_vertex_index, const TE&)
+			{
+				out_offsets_[i + 1]++;
+				in_offsets_[adj_vertex_index + 1]++;
+			});
+	}
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		out_offsets_[i + 1] += out_offsets_[i];
+		in_offsets_[i + 1] += in_offsets_[i];
+	}
+
+	out_vertex_indexes_.resize(out_offsets_[vertex_count_]);
+	out_costs_.resize(out_offsets_[vertex_count_]);
+	in_vertex_indexes_.resize(in_offsets_[vertex_count_]);
+	in_costs_.resize(in_offsets_[vertex_count_]);
+
+	// ߱ĸдλ
+	vector<size_t> in_positions(in_offsets_.begin(), in_offsets_.end() - 1);
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		size_t out_position = out_offsets_[i];
+
+		graph.ForEachAdjacentEdge(i, [&](size_t adj_vertex_index, const TE& cost)
+			{
+				out_vertex_indexes_[out_position] = adj_vertex_index;
+				out_costs_[out_position] = cost;
+				out_position++;
+
+				size_t& in_position = in_positions[adj_vertex_index];
+				in_vertex_indexes_[in_position] = i;
+				in_costs_[in_position] = cost;
+				in_position++;
+			});
+	}
+}
+
+template<typename TE>
+void DirectionOptimizingBFS<TE>::SetThresholds(size_t alpha, size_t beta)
+{
+	alpha_ = alpha;
+	beta_ = beta;
+}
+
+template<typename TE>
+void DirectionOptimizingBFS<TE>::BFS(TraversalVisitor<TE>& visitor) const
+{
+	vector<bool> is_visited(vertex_count_);
+
+	size_t unvisited_edge_count = out_offsets_[vertex_count_];
+
+	int bfs_number_initial = 0;
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		if (!is_visited[i])
+		{
+			BFSImp(i, bfs_number_initial,
+				is_visited, unvisited_edge_count, visitor);
+		}
+	}
+}
+
+template<typename TE>
+void DirectionOptimizingBFS<TE>::BFSImp(
+	size_t root_vertex_index,
+	int& current_bfs_number,
+	vector<bool>& is_visited,
+	size_t& unvisited_edge_count,
+	TraversalVisitor<TE>& visitor) const
+{
+	vector<size_t> frontier{ root_vertex_index };
+	vector<size_t> next_frontier;
+	// ԵʱO(1)ж϶Ƿλڵǰǰ
+	vector<bool> is_in_frontier;
+
+	is_visited[root_vertex_index] = true;
+	unvisited_edge_count -=
+		out_offsets_[root_vertex_index + 1] - out_offsets_[root_vertex_index];
+
+	bool is_bottom_up = false;
+
+	while (!frontier.empty())
+	{
+		size_t frontier_edge_count = 0;
+
+		for (auto i : frontier)
+		{
+			frontier_edge_count += out_offsets_[i + 1] - out_offsets_[i];
+		}
+
+		if (!is_bottom_up
+			&& frontier_edge_count * alpha_ > unvisited_edge_count)
+		{
+			is_bottom_up = true;
+		}
+		else if (is_bottom_up && frontier.size() * beta_ < vertex_count_)
+		{
+			is_bottom_up = false;
+		}
+
+		next_frontier.clear();
+
+		if (!is_bottom_up)
+		{
+			for (auto i : frontier)
+			{
+				visitor.OnVertexVisited(i, current_bfs_number++);
+
+				for (size_t j = out_offsets_[i]; j < out_offsets_[i + 1]; j++)
+				{
+					size_t adj_vertex_index = out_vertex_indexes_[j];
+
+					if (!is_visited[adj_vertex_index])
+					{
+						visitor.OnSpanningTreeEdge(i, adj_vertex_index, out_costs_[j]);
+
+						is_visited[adj_vertex_index] = true;
+						unvisited_edge_count -=
+							out_offsets_[adj_vertex_index + 1]
+							- out_offsets_[adj_vertex_index];
+
+						next_frontier.push_back(adj_vertex_index);
+					}
+				}
+			}
+		}
+		else
+		{
+			is_in_frontier.assign(vertex_count_, false);
+
+			for (auto i : frontier)
+			{
+				is_in_frontier[i] = true;
+				visitor.OnVertexVisited(i, current_bfs_number++);
+			}
+
+			for (size_t i = 0; i < vertex_count_; i++)
+			{
+				if (is_visited[i])
+				{
+					continue;
+				}
+
+				// ҵһλǰеĸ㼴ֹͣɨ
+				for (size_t j = in_offsets_[i]; j < in_offsets_[i + 1]; j++)
+				{
+					if (is_in_frontier[in_vertex_indexes_[j]])
+					{
+						visitor.OnSpanningTreeEdge(
+							in_vertex_indexes_[j], i, in_costs_[j]);
+
+						is_visited[i] = true;
+						unvisited_edge_count -= out_offsets_[i + 1] - out_offsets_[i];
+
+						next_frontier.push_back(i);
+						break;
+					}
+				}
+			}
+		}
+
+		frontier.swap(next_frontier);
+	}
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+
+using std::vector;
+using std::uint8_t;
+
+// 鼯ཻɭ֣
+// ʱ·ѹϲʱȺϲmβܿΪO(m (n))
+class DisjointSet final
+{
+private:
+	vector<size_t> parents_;
+	// ߵϽ磬log2(n)һֽڼɴ
+	vector<uint8_t> ranks_;
+
+public:
+	DisjointSet() = default;
+	explicit DisjointSet(size_t element_count);
+	~DisjointSet() = default;
+
+	// ԱResetΪelement_countԶĵԪؼ
+	void Reset(size_t element_count);
+
+	size_t GetElementCount() const;
+
+	// ԱFindԪڼϵĴԪأ·ϵԪֱӹҵԪ
+	size_t Find(size_t element);
+
+	// ԱUnionϲԪڵļϣԭͬһʱfalse
+	bool Union(size_t first_element, size_t second_element);
+};
+
+inline DisjointSet::DisjointSet(size_t element_count)
+{
+	Reset(element_count);
+}
+
+inline void DisjointSet::Reset(size_t element_count)
+{
+	parents_.resize(element_count);
+	ranks_.assign(element_count, 0);
+
+	for (size_t i = 0; i < element_count; i++)
+	{
+		parents_[i] = i;
+	}
+}
+
+inline size_t DisjointSet::GetElementCount() const
+{
+	return parents_.size();
+}
+
+inline size_t DisjointSet::Find(size_t element)
+{
+	size_t root = element;
+
+	while (parents_[root] != root)
+	{
+		root = parents_[root];
+	}
+
+	// ڶ·ϵԪضֱָʹõԱϵĵݹ
+	while (parents_[element] != root)
+	{
+		size_t next_element = parents_[element];
+		parents_[element] = root;
+		element = next_element;
+	}
+
+	return root;
+}
+
+inline bool DisjointSet::Union(size_t first_element, size_t second_element)
+{
+	size_t first_root = Find(first_element);
+	size_t second_root = Find(second_element);
+
+	if (first_root == second_root)
+	{
+		return false;
+	}
+
+	if (ranks_[first_root] < ranks_[second_root])
+	{
+		std::swap(first_root, second_root);
+	}
+
+	parents_[second_root] = first_root;
+
+	if (ranks_[first_root] == ranks_[second_root])
+	{
+		ranks_[first_root]++;
+	}
+
+	return true;
+}
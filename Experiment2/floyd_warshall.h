@@ -0,0 +1,277 @@
+#pragma once
+
+#include <iostream>
+#include <format>
+#include <string>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "thread_pool.h"
+
+using std::cout;
+using std::endl;
+
+using std::format;
+
+using std::string;
+using std::vector;
+using std::numeric_limits;
+
+// ȫԴ·
+// ģTE: Ȩ
+// ţÿгstrideԪأstrideСڶĲΪ䣩
+// ij̾Ϊdistances[i * stride + j]ɴʱΪinfinity_cost
+template<typename TE>
+class AllPairsShortestPathResults final
+{
+public:
+	size_t vertex_count = 0;
+	size_t stride = 0;
+	TE infinity_cost = 0;
+	vector<TE> distances;
+
+	AllPairsShortestPathResults() = default;
+	~AllPairsShortestPathResults() = default;
+
+	const TE& GetDistance(size_t begin_vertex_index, size_t end_vertex_index) const
+	{
+		return distances[begin_vertex_index * stride + end_vertex_index];
+	}
+
+	// ̬ԱDisplayAllPairsShortestPathResultsڽӾͬĸʽչʾ
+	static void DisplayAllPairsShortestPathResults(
+		const AllPairsShortestPathResults<TE>& results)
+	{
+		cout << "[ALL-PAIRS SHORTEST PATH DISTANCES]" << endl;
+		cout << "   |";
+
+		for (size_t i = 0; i < results.vertex_count; i++)
+		{
+			cout << format("{0:>3d}", i);
+		}
+
+		cout << endl;
+
+		cout << string(3 + 1, '-');
+		cout << string(3 * results.vertex_count, '-') << endl;
+
+		for (size_t i = 0; i < results.vertex_count; i++)
+		{
+			cout << format("{0:-3d}|", i);
+
+			for (size_t j = 0; j < results.vertex_count; j++)
+			{
+				const TE& current_distance = results.GetDistance(i, j);
+
+				if (current_distance == results.infinity_cost)
+				{
+					cout << format("{0:>3c}", '.');
+				}
+				else
+				{
+					cout << format("{0:>3d}", current_distance);
+				}
+			}
+
+			cout << endl;
+		}
+
+		cout << endl;
+	}
+};
+
+// ֿFloyd-WarshallȫԴ·㷨
+// 󱻻ΪkBlockSize * kBlockSizeķ飬ÿkδ
+// 1. Խǿ2. ԽǿͬСͬеĸ飻3. 顣
+// 23еĸ黥̳߳زдÿĹԷL1/L2档
+// ڲڲѭǶһ d[i][j] = min(d[i][j], d[i][k] + d[k][j]) min-plus㣬
+// ʱAVX2MSVC/arch:AVX2GCC/Clang-mavx2TEΪintfloatʱʹAVX2ָ
+// ʹñѭɱԶ
+class BlockedFloydWarshall final
+{
+private:
+	// intΪ64 * 64 * 4ֽ = 16KBͬʱ볣L1/L2
+	static constexpr size_t kBlockSize = 64;
+
+	// ԳΪkBlockSizeһִ row[j] = min(row[j], via + k_row[j])
+	template<typename TE>
+	static void MinPlusRow(TE* row, const TE* k_row, TE via);
+
+	// Է(k_block,k_block)(row_block,k_block)(k_block,column_block)·(row_block,column_block)
+	template<typename TE>
+	static void UpdateBlock(
+		vector<TE>& distances,
+		size_t stride,
+		size_t row_block,
+		size_t column_block,
+		size_t k_block);
+
+public:
+	// ̬ԱGetPaddedStrideȡΪvertex_countʱгΪkBlockSizeı
+	static size_t GetPaddedStride(size_t vertex_count);
+
+	// ̬ԱģRunڰšгΪstrideľԭȫԴ·
+	// ǰޱߴworking_infinity䲿ȻԽΪ0
+	// working_infinity벻thread_poolΪʱִ߳
+	template<typename TE>
+	static void Run(vector<TE>& distances, size_t stride, ThreadPool* thread_pool);
+
+	// ̬ԱģGetWorkingInfinityȡʱʾֵ
+	template<typename TE>
+	static TE GetWorkingInfinity();
+};
+
+inline size_t BlockedFloydWarshall::GetPaddedStride(size_t vertex_count)
+{
+	return (vertex_count + kBlockSize - 1) / kBlockSize * kBlockSize;
+}
+
+template<typename TE>
+TE BlockedFloydWarshall::GetWorkingInfinity()
+{
+	if constexpr (numeric_limits<TE>::has_infinity)
+	{
+		return numeric_limits<TE>::infinity();
+	}
+	else
+	{
+		return numeric_limits<TE>::max() / 2;
+	}
+}
+
+template<typename TE>
+void BlockedFloydWarshall::MinPlusRow(TE* row, const TE* k_row, TE via)
+{
+#ifdef __AVX2__
+	if constexpr (std::is_same_v<TE, int>)
+	{
+		__m256i via_vector = _mm256_set1_epi32(via);
+
+		for (size_t j = 0; j < kBlockSize; j += 8)
+		{
+			__m256i current_vector =
+				_mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + j));
+			__m256i k_vector =
+				_mm256_loadu_si256(reinterpret_cast<const __m256i*>(k_row + j));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(row + j),
+				_mm256_min_epi32(current_vector, _mm256_add_epi32(via_vector, k_vector)));
+		}
+
+		return;
+	}
+	else if constexpr (std::is_same_v<TE, float>)
+	{
+		__m256 via_vector = _mm256_set1_ps(via);
+
+		for (size_t j = 0; j < kBlockSize; j += 8)
+		{
+			_mm256_storeu_ps(row + j, _mm256_min_ps(
+				_mm256_loadu_ps(row + j),
+				_mm256_add_ps(via_vector, _mm256_loadu_ps(k_row + j))));
+		}
+
+		return;
+	}
+#endif
+
+	for (size_t j = 0; j < kBlockSize; j++)
+	{
+		TE candidate = via + k_row[j];
+		row[j] = candidate < row[j] ? candidate : row[j];
+	}
+}
+
+template<typename TE>
+void BlockedFloydWarshall::UpdateBlock(
+	vector<TE>& distances,
+	size_t stride,
+	size_t row_block,
+	size_t column_block,
+	size_t k_block)
+{
+	TE* data = distances.data();
+
+	const size_t row_begin = row_block * kBlockSize;
+	const size_t column_begin = column_block * kBlockSize;
+	const size_t k_begin = k_block * kBlockSize;
+
+	for (size_t k = k_begin; k < k_begin + kBlockSize; k++)
+	{
+		const TE* k_row = data + k * stride + column_begin;
+
+		for (size_t i = row_begin; i < row_begin + kBlockSize; i++)
+		{
+			MinPlusRow(data + i * stride + column_begin, k_row, data[i * stride + k]);
+		}
+	}
+}
+
+template<typename TE>
+void BlockedFloydWarshall::Run(
+	vector<TE>& distances, size_t stride, ThreadPool* thread_pool)
+{
+	const size_t block_count = stride / kBlockSize;
+
+	auto run_range = [&](size_t range_end, auto&& func)
+	{
+		if (thread_pool != nullptr)
+		{
+			thread_pool->ParallelFor(0, range_end, func);
+		}
+		else
+		{
+			func(0, 0, range_end);
+		}
+	};
+
+	for (size_t k_block = 0; k_block < block_count; k_block++)
+	{
+		UpdateBlock(distances, stride, k_block, k_block, k_block);
+
+		// ԽǿͬСͬеĸ飺ǰblock_countΪͬи飬block_countΪͬи
+		run_range(2 * block_count, [&](size_t, size_t chunk_begin, size_t chunk_end)
+			{
+				for (size_t i = chunk_begin; i < chunk_end; i++)
+				{
+					size_t other_block = i % block_count;
+
+					if (other_block == k_block)
+					{
+						continue;
+					}
+
+					if (i < block_count)
+					{
+						UpdateBlock(distances, stride, k_block, other_block, k_block);
+					}
+					else
+					{
+						UpdateBlock(distances, stride, other_block, k_block, k_block);
+					}
+				}
+			});
+
+		// 飬˳ָ߳
+		run_range(block_count * block_count,
+			[&](size_t, size_t chunk_begin, size_t chunk_end)
+			{
+				for (size_t i = chunk_begin; i < chunk_end; i++)
+				{
+					size_t row_block = i / block_count;
+					size_t column_block = i % block_count;
+
+					if (row_block != k_block && column_block != k_block)
+					{
+						UpdateBlock(distances, stride, row_block, column_block, k_block);
+					}
+				}
+			});
+	}
+}
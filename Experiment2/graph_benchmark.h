@@ -0,0 +1,464 @@
+#pragma once
+
+#include <iostream>
+#include <format>
+#include <string>
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#include <Psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "adjacency_list_graph.h"
+#include "adjacency_matrix_graph.h"
+#include "csr_graph.h"
+#include "traversal_results.h"
+#include "thread_pool.h"
+#include "vertex_reordering.h"
+
+using std::cout;
+using std::endl;
+
+using std::format;
+
+using std::string;
+using std::vector;
+using std::tuple;
+using std::pair;
+using std::get;
+
+// һظִɴεĺʱͳƣλΪ
+class BenchmarkStatistics final
+{
+public:
+	size_t repetition_count = 0;
+	double mean_seconds = 0;
+	// ׼ִֻһʱΪ0
+	double standard_deviation_seconds = 0;
+	double min_seconds = 0;
+	double max_seconds = 0;
+
+	BenchmarkStatistics() = default;
+	~BenchmarkStatistics() = default;
+
+	// ̬ԱFromSamplesɸִеĺʱͳ
+	static BenchmarkStatistics FromSamples(const vector<double>& samples);
+};
+
+inline BenchmarkStatistics BenchmarkStatistics::FromSamples(const vector<double>& samples)
+{
+	BenchmarkStatistics statistics;
+
+	if (samples.empty())
+	{
+		return statistics;
+	}
+
+	statistics.repetition_count = samples.size();
+	statistics.min_seconds = *std::min_element(samples.begin(), samples.end());
+	statistics.max_seconds = *std::max_element(samples.begin(), samples.end());
+
+	double sum = 0;
+
+	for (auto i : samples)
+	{
+		sum += i;
+	}
+
+	statistics.mean_seconds = sum / samples.size();
+
+	if (samples.size() > 1)
+	{
+		double squared_deviation_sum = 0;
+
+		for (auto i : samples)
+		{
+			squared_deviation_sum +=
+				(i - statistics.mean_seconds) * (i - statistics.mean_seconds);
+		}
+
+		statistics.standard_deviation_seconds =
+			std::sqrt(squared_deviation_sum / (samples.size() - 1));
+	}
+
+	return statistics;
+}
+
+// ͼ׼
+// ģTE: Ȩ; TV:
+// ͬһͼڽӱڽӾ󣨽Ȩ󡢸λִ洢ʽCSRִ洢ʽͼ
+// ֱͼݹ顢ʽջDFSBFSԼ洢ʽ֮תĺʱ
+// Cuthill-McKeeŶٽһCSRͼCSR-RCMظԱȽŶԾֲԵӰ졣
+// ÿȲʱִһԤȣټʱִrepetition_countΣƽʱ׼
+// ϵ׼/ƽֵÿ봦ıͼı/ƽʱ
+// ÿִ洢ʽ󱨸ķֵפڴ棬ۼƵˮλǸô洢ʽ
+// ͬʱһαô洢ʽʹˮλ˶٣δǰֵʱΪ0
+// ڽӾĿռ붥ƽȣmax_matrix_vertex_countʱڽӾصĸ
+// ݹDFSĵݹɴﶥmax_recursive_vertex_countʱݹDFSջ
+// WindowsĬջֻ1 MiB
+template<typename TE, typename TV>
+class GraphBenchmark final
+{
+private:
+	// ֻ洢ķʹĺʱĴ洢
+	class CountingVisitor final :public TraversalVisitor<TE>
+	{
+	public:
+		size_t visited_count = 0;
+		size_t spanning_tree_edge_count = 0;
+
+		void OnVertexVisited(size_t, int) override
+		{
+			visited_count++;
+		}
+
+		void OnSpanningTreeEdge(size_t, size_t, const TE&) override
+		{
+			spanning_tree_edge_count++;
+		}
+	};
+
+	size_t repetition_count_ = 5;
+	size_t max_matrix_vertex_count_ = 4096;
+	size_t max_recursive_vertex_count_ = 2048;
+
+	// ԱģMeasureԤһκʱִfunc repetition_count_
+	template<typename TFunc>
+	BenchmarkStatistics Measure(TFunc&& func) const;
+
+	// ԱReportһĲ
+	void Report(
+		const string& backend_name,
+		const string& operation_name,
+		size_t edge_count,
+		const BenchmarkStatistics& statistics) const;
+
+	// ԱReportPeakResidentSetSizeһִ洢ʽķֵפڴ棬
+	// previous_peak_sizeprevious_peak_sizeΪǰֵ
+	void ReportPeakResidentSetSize(const string& backend_name, size_t& previous_peak_size) const;
+
+	// ԱģBenchmarkTraversalsѽõͼĵݹDFSDFSʽջDFSBFS
+	// max_recursive_vertex_count_ʱݹDFS
+	template<typename TGraph>
+	void BenchmarkTraversals(const string& backend_name, const TGraph& graph) const;
+
+public:
+	explicit GraphBenchmark(
+		size_t repetition_count = 5,
+		size_t max_matrix_vertex_count = 4096,
+		size_t max_recursive_vertex_count = 2048);
+	~GraphBenchmark() = default;
+
+	// ԱRungraph_dataͼȫԣgraph_name
+	// graph_dataAdjacencyListGraph::BuildGraphĲʽͬ
+	void Run(
+		const string& graph_name,
+		const tuple<vector<TV>, vector<vector<pair<size_t, TE>>>, size_t>& graph_data) const;
+
+	// ̬ԱGetPeakResidentSetSizeȡķֵפڴֽ޷ȡʱ0
+	static size_t GetPeakResidentSetSize();
+};
+
+template<typename TE, typename TV>
+GraphBenchmark<TE, TV>::GraphBenchmark(
+	size_t repetition_count,
+	size_t max_matrix_vertex_count,
+	size_t max_recursive_vertex_count) :
+	repetition_count_(std::max<size_t>(1, repetition_count)),
+	max_matrix_vertex_count_(max_matrix_vertex_count),
+	max_recursive_vertex_count_(max_recursive_vertex_count)
+{}
+
+template<typename TE, typename TV>
+template<typename TFunc>
+BenchmarkStatistics GraphBenchmark<TE, TV>::Measure(TFunc&& func) const
+{
+	func();
+
+	vector<double> samples;
+	samples.reserve(repetition_count_);
+
+	for (size_t i = 0; i < repetition_count_; i++)
+	{
+		auto begin_time = std::chrono::steady_clock::now();
+
+		func();
+
+		auto end_time = std::chrono::steady_clock::now();
+
+		samples.push_back(std::chrono::duration<double>(end_time - begin_time).count());
+	}
+
+	return BenchmarkStatistics::FromSamples(samples);
+}
+
+template<typename TE, typename TV>
+void GraphBenchmark<TE, TV>::Report(
+	const string& backend_name,
+	const string& operation_name,
+	size_t edge_count,
+	const BenchmarkStatistics& statistics) const
+{
+	double coefficient_of_variation = statistics.mean_seconds > 0 ?
+		statistics.standard_deviation_seconds / statistics.mean_seconds : 0;
+	double edges_per_second = statistics.mean_seconds > 0 ?
+		edge_count / statistics.mean_seconds : 0;
+
+	cout << format("{0:<16s}{1:<20s}{2:>12.3f}{3:>12.3f}{4:>12.3f}{5:>8.1f}%{6:>16.0f}",
+		backend_name,
+		operation_name,
+		statistics.mean_seconds * 1000,
+		statistics.standard_deviation_seconds * 1000,
+		statistics.min_seconds * 1000,
+		coefficient_of_variation * 100,
+		edges_per_second) << endl;
+}
+
+template<typename TE, typename TV>
+void GraphBenchmark<TE, TV>::ReportPeakResidentSetSize(
+	const string& backend_name, size_t& previous_peak_size) const
+{
+	size_t peak_size = GetPeakResidentSetSize();
+
+	cout << format("{0:<16s}PROCESS PEAK RSS SO FAR: {1:.1f} MiB (+{2:.1f} MiB)",
+		backend_name,
+		peak_size / (1024.0 * 1024.0),
+		(peak_size - std::min(peak_size, previous_peak_size)) / (1024.0 * 1024.0)) << endl;
+
+	previous_peak_size = std::max(previous_peak_size, peak_size);
+}
+
+template<typename TE, typename TV>
+template<typename TGraph>
+void GraphBenchmark<TE, TV>::BenchmarkTraversals(
+	const string& backend_name, const TGraph& graph) const
+{
+	if (graph.vertex_count <= max_recursive_vertex_count_)
+	{
+		Report(backend_name, "DFS(RECURSIVE)", graph.edge_count, Measure([&]
+			{
+				CountingVisitor visitor;
+				graph.DFS(false, visitor);
+			}));
+	}
+
+	Report(backend_name, "DFS(ITERATIVE)", graph.edge_count, Measure([&]
+		{
+			CountingVisitor visitor;
+			graph.DFS(true, visitor);
+		}));
+
+	Report(backend_name, "DFS(EXPLICIT STACK)", graph.edge_count, Measure([&]
+		{
+			CountingVisitor visitor;
+			graph.DFSExplicitStack(visitor);
+		}));
+
+	Report(backend_name, "BFS", graph.edge_count, Measure([&]
+		{
+			CountingVisitor visitor;
+			graph.BFS(visitor);
+		}));
+}
+
+template<typename TE, typename TV>
+void GraphBenchmark<TE, TV>::Run(
+	const string& graph_name,
+	const tuple<vector<TV>, vector<vector<pair<size_t, TE>>>, size_t>& graph_data) const
+{
+	const size_t vertex_count = get<0>(graph_data).size();
+	const size_t edge_count = get<2>(graph_data);
+	const bool is_matrix_enabled = vertex_count <= max_matrix_vertex_count_;
+	const TE infinity_cost = 0x3F3F3F3F;
+
+	// (MT)׺תʹ̳߳еọ̈̄߳дԤȷõ
+	ThreadPool thread_pool;
+
+	cout << format("[BENCHMARK] GRAPH: {0}, VERTEXES: {1}, EDGES: {2}, REPETITIONS: {3}",
+		graph_name, vertex_count, edge_count, repetition_count_) << endl;
+
+	if (!is_matrix_enabled)
+	{
+		cout << format("<MORE THAN {0} VERTEXES, ADJ-MATRIX BENCHMARKS SKIPPED.>",
+			max_matrix_vertex_count_) << endl;
+	}
+
+	if (vertex_count > max_recursive_vertex_count_)
+	{
+		cout << format("<MORE THAN {0} VERTEXES, DFS(RECURSIVE) SKIPPED TO AVOID STACK OVERFLOW.>",
+			max_recursive_vertex_count_) << endl;
+	}
+
+	// ̷ֵפڴۼƵˮλȡͼ֮ǰķֵ
+	size_t previous_peak_size = GetPeakResidentSetSize();
+
+	cout << format("{0:<16s}{1:<20s}{2:>12s}{3:>12s}{4:>12s}{5:>9s}{6:>16s}",
+		"BACKEND", "OPERATION", "MEAN(ms)", "STDDEV(ms)", "MIN(ms)", "CV", "EDGES/s") << endl;
+
+	AdjacencyListGraph<TE, TV> graph_adj_list;
+
+	Report("ADJ-LIST", "BUILD", edge_count, Measure([&]
+		{
+			graph_adj_list.BuildGraph(graph_data);
+		}));
+
+	BenchmarkTraversals("ADJ-LIST", graph_adj_list);
+
+	if (is_matrix_enabled)
+	{
+		Report("ADJ-LIST", "TO ADJ-MATRIX", edge_count, Measure([&]
+			{
+				graph_adj_list.GetAdjacencyMatrixGraphData(infinity_cost);
+			}));
+
+		vector<TE> cost_matrix(vertex_count * vertex_count);
+
+		Report("ADJ-LIST", "TO ADJ-MATRIX(MT)", edge_count, Measure([&]
+			{
+				graph_adj_list.WriteAdjacencyMatrix(
+					cost_matrix, vertex_count, infinity_cost, &thread_pool);
+			}));
+	}
+
+	ReportPeakResidentSetSize("ADJ-LIST", previous_peak_size);
+
+	if (is_matrix_enabled)
+	{
+		auto adj_matrix_graph_data =
+			graph_adj_list.GetAdjacencyMatrixGraphData(infinity_cost);
+
+		const pair<string, MatrixStorageMode> matrix_backends[] =
+		{
+			{ "ADJ-MATRIX", MatrixStorageMode::COST_MATRIX },
+			{ "ADJ-MATRIX-BITS", MatrixStorageMode::COST_MATRIX_WITH_BITSET }
+		};
+
+		for (auto& i : matrix_backends)
+		{
+			AdjacencyMatrixGraph<TE, TV> graph_adj_matrix;
+
+			Report(i.first, "BUILD", edge_count, Measure([&]
+				{
+					graph_adj_matrix.BuildGraph(adj_matrix_graph_data, i.second);
+				}));
+
+			BenchmarkTraversals(i.first, graph_adj_matrix);
+
+			Report(i.first, "TO ADJ-LIST", edge_count, Measure([&]
+				{
+					graph_adj_matrix.GetAdjacencyListGraphData();
+				}));
+
+			Report(i.first, "TO ADJ-LIST(MT)", edge_count, Measure([&]
+				{
+					graph_adj_matrix.GetAdjacencyListGraphData(&thread_pool);
+				}));
+
+			vector<size_t> offsets(vertex_count + 1);
+			vector<size_t> adj_vertex_indexes(graph_adj_matrix.GetAdjacencyOffsets(offsets));
+			vector<TE> costs(adj_vertex_indexes.size());
+
+			Report(i.first, "TO CSR ARRAYS(MT)", edge_count, Measure([&]
+				{
+					graph_adj_matrix.GetAdjacencyOffsets(offsets, &thread_pool);
+					graph_adj_matrix.ExportAdjacencyArrays(
+						offsets, adj_vertex_indexes, costs, &thread_pool);
+				}));
+
+			ReportPeakResidentSetSize(i.first, previous_peak_size);
+		}
+	}
+
+	CSRGraph<TE, TV> graph_csr;
+
+	Report("CSR", "BUILD", edge_count, Measure([&]
+		{
+			graph_csr.BuildGraph(graph_data);
+		}));
+
+	BenchmarkTraversals("CSR", graph_csr);
+
+	Report("CSR", "TO ADJ-LIST", edge_count, Measure([&]
+		{
+			graph_csr.GetAdjacencyListGraphData();
+		}));
+
+	if (is_matrix_enabled)
+	{
+		Report("CSR", "TO ADJ-MATRIX", edge_count, Measure([&]
+			{
+				graph_csr.GetAdjacencyMatrixGraphData(infinity_cost);
+			}));
+
+		vector<TE> cost_matrix(vertex_count * vertex_count);
+
+		Report("CSR", "TO ADJ-MATRIX(MT)", edge_count, Measure([&]
+			{
+				graph_csr.WriteAdjacencyMatrix(
+					cost_matrix, vertex_count, infinity_cost, &thread_pool);
+			}));
+	}
+
+	ReportPeakResidentSetSize("CSR", previous_peak_size);
+
+	VertexPermutation rcm_permutation;
+
+	Report("CSR", "REORDER(RCM)", edge_count, Measure([&]
+		{
+			rcm_permutation = VertexReordering::ComputePermutation(
+				graph_csr, VertexOrdering::REVERSE_CUTHILL_MCKEE);
+		}));
+
+	CSRGraph<TE, TV> reordered_graph_csr;
+
+	reordered_graph_csr.BuildGraph(VertexReordering::Apply(graph_csr, rcm_permutation));
+
+	BenchmarkTraversals("CSR-RCM", reordered_graph_csr);
+
+	ReportPeakResidentSetSize("CSR-RCM", previous_peak_size);
+
+	cout << endl;
+}
+
+template<typename TE, typename TV>
+size_t GraphBenchmark<TE, TV>::GetPeakResidentSetSize()
+{
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS memory_counters;
+
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), &memory_counters, sizeof(memory_counters)))
+	{
+		return 0;
+	}
+
+	return memory_counters.PeakWorkingSetSize;
+#else
+	rusage resource_usage;
+
+	if (getrusage(RUSAGE_SELF, &resource_usage) != 0)
+	{
+		return 0;
+	}
+
+#ifdef __APPLE__
+	return static_cast<size_t>(resource_usage.ru_maxrss);
+#else
+	// Linuxru_maxrssĵλΪKiB
+	return static_cast<size_t>(resource_usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
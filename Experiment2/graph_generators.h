@@ -0,0 +1,291 @@
+#pragma once
+
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <random>
+#include <numeric>
+#include <algorithm>
+#include <cstdint>
+
+using std::vector;
+using std::tuple;
+using std::pair;
+using std::get;
+using std::make_tuple;
+using std::mt19937_64;
+using std::uniform_int_distribution;
+using std::uniform_real_distribution;
+using std::uint64_t;
+
+// ϳͼڽϴģͼϲԸͼ
+// ̬ԱģɵĶAdjacencyListGraph::BuildGraphCSRGraph::BuildGraphõĽͼ
+// ģTE: Ȩ; TV:ͣݾΪTVĬֵ
+// ɵͼԻرߣڽӾʽҲܱʾͬһͼͼÿ˵ڽӱиһΣ
+// ֻһΣıͼļԼһ¡Ȩ[1, max_cost]ھȷֲ
+// ͬĲʱɵͼȷġ
+class GraphGenerator final
+{
+private:
+	// (±,յ±,Ȩ)߼ɽͼ߼еԻر߱ȥر߱һγֵıȨ
+	template<typename TE, typename TV>
+	static auto BuildGraphData(
+		size_t vertex_count,
+		vector<tuple<size_t, size_t, TE>>& edges,
+		bool is_directed)
+		->tuple<vector<TV>, vector<vector<pair<size_t, TE>>>, size_t>;
+
+public:
+	// ̬ԱģRMATR-MATݹKroneckerͼһ֣ͼ
+	// Ϊ2^scaleedge_factor * 2^scaleߣȥǰ
+	// ÿߴڽӾ忪ʼԸabc1-a-b-cѡϡϡ¡ķ֮һݹȥ
+	// õɷֲͼɺ󶥵±꾭һû±ء
+	template<typename TE, typename TV>
+	static auto RMAT(
+		size_t scale,
+		size_t edge_factor,
+		bool is_directed,
+		uint64_t seed,
+		TE max_cost = 100,
+		double a = 0.57,
+		double b = 0.19,
+		double c = 0.19)
+		->tuple<vector<TV>, vector<vector<pair<size_t, TE>>>, size_t>;
+
+	// ̬ԱģErdosRenyiG(n, m)ģ͵Erdos-Renyiͼ
+	// vertex_count֮ѡȡedge_countԶߣȥǰ
+	template<typename TE, typename TV>
+	static auto ErdosRenyi(
+		size_t vertex_count,
+		size_t edge_count,
+		bool is_directed,
+		uint64_t seed,
+		TE max_cost = 100)
+		->tuple<vector<TV>, vector<vector<pair<size_t, TE>>>, size_t>;
+
+	// ̬ԱģGridrow_countcolumn_countеĶάͼ
+	// 㰴ȱţÿҲࡢ·Ķͼбָҡָ
+	template<typename TE, typename TV>
+	static auto Grid(
+		size_t row_count,
+		size_t column_count,
+		bool is_directed,
+		uint64_t seed,
+		TE max_cost = 100)
+		->tuple<vector<TV>, vector<vector<pair<size_t, TE>>>, size_t>;
+};
+
+template<typename TE, typename TV>
+auto GraphGenerator::BuildGraphData(
+	size_t vertex_count,
+	vector<tuple<size_t, size_t, TE>>& edges,
+	bool is_directed)
+	->tuple<vector<TV>, vector<vector<pair<size_t, TE>>>, size_t>
+{
+	// ͼıͳһΪ±Сʽʹ(u,v)(v,u)Ϊر
+	if (!is_directed)
+	{
+		for (auto& i : edges)
+		{
+			if (get<0>(i) > get<1>(i))
+			{
+				std::swap(get<0>(i), get<1>(i));
+			}
+		}
+	}
+
+	// ȶ֤رбǵһγֵı
+	std::stable_sort(edges.begin(), edges.end(), [](const auto& x, const auto& y)
+		{
+			return get<0>(x) != get<0>(y) ? get<0>(x) < get<0>(y) : get<1>(x) < get<1>(y);
+		});
+
+	auto unique_end = std::unique(edges.begin(), edges.end(), [](const auto& x, const auto& y)
+		{
+			return get<0>(x) == get<0>(y) && get<1>(x) == get<1>(y);
+		});
+
+	auto self_loop_end = std::remove_if(edges.begin(), unique_end, [](const auto& x)
+		{
+			return get<0>(x) == get<1>(x);
+		});
+
+	edges.erase(self_loop_end, edges.end());
+
+	// ͳƸڽӱһԷøڽӱ
+	vector<size_t> degrees(vertex_count);
+
+	for (auto& i : edges)
+	{
+		degrees[get<0>(i)]++;
+
+		if (!is_directed)
+		{
+			degrees[get<1>(i)]++;
+		}
+	}
+
+	vector<vector<pair<size_t, TE>>> vex_adj_data(vertex_count);
+
+	for (size_t i = 0; i < vertex_count; i++)
+	{
+		vex_adj_data[i].reserve(degrees[i]);
+	}
+
+	for (auto& i : edges)
+	{
+		vex_adj_data[get<0>(i)].emplace_back(get<1>(i), get<2>(i));
+
+		if (!is_directed)
+		{
+			vex_adj_data[get<1>(i)].emplace_back(get<0>(i), get<2>(i));
+		}
+	}
+
+	return make_tuple(vector<TV>(vertex_count), std::move(vex_adj_data), edges.size());
+}
+
+template<typename TE, typename TV>
+auto GraphGenerator::RMAT(
+	size_t scale,
+	size_t edge_factor,
+	bool is_directed,
+	uint64_t seed,
+	TE max_cost,
+	double a,
+	double b,
+	double c)
+	->tuple<vector<TV>, vector<vector<pair<size_t, TE>>>, size_t>
+{
+	const size_t vertex_count = size_t(1) << scale;
+	const size_t edge_count = edge_factor * vertex_count;
+
+	mt19937_64 random_engine(seed);
+	uniform_real_distribution<double> quadrant_distribution(0.0, 1.0);
+	uniform_int_distribution<long long> cost_distribution(1, static_cast<long long>(max_cost));
+
+	vector<size_t> permutation(vertex_count);
+	std::iota(permutation.begin(), permutation.end(), 0);
+	std::shuffle(permutation.begin(), permutation.end(), random_engine);
+
+	vector<tuple<size_t, size_t, TE>> edges;
+	edges.reserve(edge_count);
+
+	for (size_t i = 0; i < edge_count; i++)
+	{
+		size_t begin_vertex_index = 0;
+		size_t end_vertex_index = 0;
+
+		for (size_t j = 0; j < scale; j++)
+		{
+			double current_random = quadrant_distribution(random_engine);
+
+			begin_vertex_index <<= 1;
+			end_vertex_index <<= 1;
+
+			if (current_random < a)
+			{
+				continue;
+			}
+
+			if (current_random < a + b)
+			{
+				end_vertex_index |= 1;
+			}
+			else if (current_random < a + b + c)
+			{
+				begin_vertex_index |= 1;
+			}
+			else
+			{
+				begin_vertex_index |= 1;
+				end_vertex_index |= 1;
+			}
+		}
+
+		edges.emplace_back(
+			permutation[begin_vertex_index],
+			permutation[end_vertex_index],
+			static_cast<TE>(cost_distribution(random_engine)));
+	}
+
+	return BuildGraphData<TE, TV>(vertex_count, edges, is_directed);
+}
+
+template<typename TE, typename TV>
+auto GraphGenerator::ErdosRenyi(
+	size_t vertex_count,
+	size_t edge_count,
+	bool is_directed,
+	uint64_t seed,
+	TE max_cost)
+	->tuple<vector<TV>, vector<vector<pair<size_t, TE>>>, size_t>
+{
+	vector<tuple<size_t, size_t, TE>> edges;
+
+	if (vertex_count == 0)
+	{
+		return BuildGraphData<TE, TV>(vertex_count, edges, is_directed);
+	}
+
+	mt19937_64 random_engine(seed);
+	uniform_int_distribution<size_t> vertex_distribution(0, vertex_count - 1);
+	uniform_int_distribution<long long> cost_distribution(1, static_cast<long long>(max_cost));
+
+	edges.reserve(edge_count);
+
+	for (size_t i = 0; i < edge_count; i++)
+	{
+		size_t begin_vertex_index = vertex_distribution(random_engine);
+		size_t end_vertex_index = vertex_distribution(random_engine);
+
+		edges.emplace_back(
+			begin_vertex_index,
+			end_vertex_index,
+			static_cast<TE>(cost_distribution(random_engine)));
+	}
+
+	return BuildGraphData<TE, TV>(vertex_count, edges, is_directed);
+}
+
+template<typename TE, typename TV>
+auto GraphGenerator::Grid(
+	size_t row_count,
+	size_t column_count,
+	bool is_directed,
+	uint64_t seed,
+	TE max_cost)
+	->tuple<vector<TV>, vector<vector<pair<size_t, TE>>>, size_t>
+{
+	mt19937_64 random_engine(seed);
+	uniform_int_distribution<long long> cost_distribution(1, static_cast<long long>(max_cost));
+
+	vector<tuple<size_t, size_t, TE>> edges;
+	edges.reserve(2 * row_count * column_count);
+
+	for (size_t i = 0; i < row_count; i++)
+	{
+		for (size_t j = 0; j < column_count; j++)
+		{
+			size_t current_vertex_index = i * column_count + j;
+
+			if (j + 1 < column_count)
+			{
+				edges.emplace_back(
+					current_vertex_index,
+					current_vertex_index + 1,
+					static_cast<TE>(cost_distribution(random_engine)));
+			}
+
+			if (i + 1 < row_count)
+			{
+				edges.emplace_back(
+					current_vertex_index,
+					current_vertex_index + column_count,
+					static_cast<TE>(cost_distribution(random_engine)));
+			}
+		}
+	}
+
+	return BuildGraphData<TE, TV>(row_count * column_count, edges, is_directed);
+}
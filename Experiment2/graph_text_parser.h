@@ -0,0 +1,443 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <sstream>
+#include <vector>
+#include <tuple>
+#include <atomic>
+#include <charconv>
+#include <algorithm>
+#include <type_traits>
+
+#include "csr_graph.h"
+#include "mapped_file.h"
+#include "thread_pool.h"
+
+using std::string;
+using std::string_view;
+using std::istringstream;
+using std::vector;
+using std::tuple;
+using std::get;
+using std::atomic;
+using std::from_chars;
+
+// ıʽͼļĿٽ
+// ıʽһǱʾǷͼһ֣
+// ڶǱʾͼһvertex_count
+// Ǳʾͼedge_count
+// vertex_countTV͵Ķݣ
+// ˺edge_count(±-յ±-Ȩ)ݡ
+// ļӳ䵽ڴֱfrom_chars
+// Ϊɿ鲢нֱͨдCSR飬
+// Ϊÿ㵥ڽڽӱ˳ʱ˳ͬ
+class GraphTextParser final
+{
+private:
+	static bool IsWhitespace(char c);
+
+	// հףcurrentָһǺŵĿͷ
+	static void SkipWhitespace(const char*& current, const char* end);
+
+	// һǺΪvalueɹʱcurrentָǺ֮
+	template<typename T>
+	static bool ParseToken(const char*& current, const char* end, T& value);
+
+	// ͳ[begin, end)пʼļǺ
+	static size_t CountTokens(const char* begin, const char* end);
+
+public:
+	// ̬ԱģParseļgraphis_directedͼǷ򣬳ɹʱtrue
+	// thread_poolΪʱڵ߳ȫ
+	template<typename TE, typename TV>
+	static bool Parse(
+		const string& file_name,
+		CSRGraph<TE, TV>& graph,
+		bool& is_directed,
+		ThreadPool* thread_pool = nullptr);
+
+	// ̬ԱģParseڴеıgraphtextΪջֻհʱͼtrue
+	template<typename TE, typename TV>
+	static bool Parse(
+		string_view text,
+		CSRGraph<TE, TV>& graph,
+		bool& is_directed,
+		ThreadPool* thread_pool = nullptr);
+};
+
+inline bool GraphTextParser::IsWhitespace(char c)
+{
+	return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\v' || c == '\f';
+}
+
+inline void GraphTextParser::SkipWhitespace(const char*& current, const char* end)
+{
+	while (current < end && IsWhitespace(*current))
+	{
+		current++;
+	}
+}
+
+template<typename T>
+bool GraphTextParser::ParseToken(const char*& current, const char* end, T& value)
+{
+	SkipWhitespace(current, end);
+
+	if (current == end)
+	{
+		return false;
+	}
+
+	// operator>>ȡcharΪһ£ֻȡһǿհַ
+	if constexpr (std::is_same_v<T, char>)
+	{
+		value = *current++;
+		return true;
+	}
+	else if constexpr (std::is_same_v<T, bool>)
+	{
+		int int_value = 0;
+		auto parse_result = from_chars(current, end, int_value);
+
+		if (parse_result.ec != std::errc())
+		{
+			return false;
+		}
+
+		value = int_value != 0;
+		current = parse_result.ptr;
+		return true;
+	}
+	else if constexpr (std::is_arithmetic_v<T>)
+	{
+		auto parse_result = from_chars(current, end, value);
+
+		if (parse_result.ec != std::errc())
+		{
+			return false;
+		}
+
+		current = parse_result.ptr;
+		return true;
+	}
+	else
+	{
+		// ˻صֻڵǺ
+		const char* token_end = current;
+
+		while (token_end < end && !IsWhitespace(*token_end))
+		{
+			token_end++;
+		}
+
+		istringstream token_stream(string(current, token_end));
+		token_stream >> value;
+
+		current = token_end;
+		return static_cast<bool>(token_stream);
+	}
+}
+
+inline size_t GraphTextParser::CountTokens(const char* begin, const char* end)
+{
+	size_t token_count = 0;
+	bool is_in_token = false;
+
+	for (const char* i = begin; i < end; i++)
+	{
+		bool is_whitespace = IsWhitespace(*i);
+
+		if (!is_whitespace && !is_in_token)
+		{
+			token_count++;
+		}
+
+		is_in_token = !is_whitespace;
+	}
+
+	return token_count;
+}
+
+template<typename TE, typename TV>
+bool GraphTextParser::Parse(
+	const string& file_name,
+	CSRGraph<TE, TV>& graph,
+	bool& is_directed,
+	ThreadPool* thread_pool)
+{
+	MappedFile mapped_file;
+
+	if (!mapped_file.Open(file_name))
+	{
+		return false;
+	}
+
+	return Parse(
+		string_view(mapped_file.GetData(), mapped_file.GetSize()),
+		graph, is_directed, thread_pool);
+}
+
+template<typename TE, typename TV>
+bool GraphTextParser::Parse(
+	string_view text,
+	CSRGraph<TE, TV>& graph,
+	bool& is_directed,
+	ThreadPool* thread_pool)
+{
+	const char* current = text.data();
+	const char* const end = text.data() + text.size();
+
+	size_t vertex_count = 0;
+	size_t edge_count = 0;
+
+	// ļֻհ׵ļΪͼɵ÷ͼ
+	SkipWhitespace(current, end);
+
+	if (current == end)
+	{
+		is_directed = false;
+		graph.BuildGraph(vector<TV>(), vector<size_t>(1, 0), vector<size_t>(), vector<TE>(), 0);
+		return true;
+	}
+
+	if (!ParseToken(current, end, is_directed)
+		|| !ParseToken(current, end, vertex_count)
+		|| !ParseToken(current, end, edge_count))
+	{
+		return false;
+	}
+
+	vector<TV> vertexes(vertex_count);
+
+	for (auto& i : vertexes)
+	{
+		if (!ParseToken(current, end, i))
+		{
+			return false;
+		}
+	}
+
+	const size_t chunk_count = thread_pool ? thread_pool->GetThreadCount() : 1;
+
+	auto run_chunks = [&](auto&& func)
+	{
+		if (thread_pool)
+		{
+			thread_pool->Run(func);
+		}
+		else
+		{
+			func(0);
+		}
+	};
+
+	auto run_range = [&](size_t range_end, auto&& func)
+	{
+		if (thread_pool)
+		{
+			thread_pool->ParallelFor(0, range_end, func);
+		}
+		else
+		{
+			func(0, 0, range_end);
+		}
+	};
+
+	// ֱ߽ƶհַ֤ǺŲ
+	vector<const char*> chunk_bounds(chunk_count + 1);
+	chunk_bounds[0] = current;
+	chunk_bounds[chunk_count] = end;
+
+	for (size_t i = 1; i < chunk_count; i++)
+	{
+		const char* bound =
+			current + static_cast<size_t>(end - current) * i / chunk_count;
+
+		bound = std::max(bound, chunk_bounds[i - 1]);
+
+		while (bound < end && !IsWhitespace(*bound))
+		{
+			bound++;
+		}
+
+		chunk_bounds[i] = bound;
+	}
+
+	// һ飺ͳƸļǺȷÿһǺȫе
+	vector<size_t> chunk_token_offsets(chunk_count + 1, 0);
+
+	run_chunks([&](size_t chunk_index)
+		{
+			chunk_token_offsets[chunk_index + 1] = CountTokens(
+				chunk_bounds[chunk_index], chunk_bounds[chunk_index + 1]);
+		});
+
+	for (size_t i = 0; i < chunk_count; i++)
+	{
+		chunk_token_offsets[i + 1] += chunk_token_offsets[i];
+	}
+
+	if (chunk_token_offsets[chunk_count] < 3 * edge_count)
+	{
+		return false;
+	}
+
+	// ڶ飺ǺŰÿǺŽӦߵĶӦֶ
+	vector<size_t> begin_indexes(edge_count);
+	vector<size_t> end_indexes(edge_count);
+	vector<TE> edge_costs(edge_count);
+	atomic<bool> is_failed = false;
+
+	run_chunks([&](size_t chunk_index)
+		{
+			const char* chunk_current = chunk_bounds[chunk_index];
+			const char* const chunk_end = chunk_bounds[chunk_index + 1];
+
+			size_t token_index = chunk_token_offsets[chunk_index];
+			const size_t token_end = std::min(
+				chunk_token_offsets[chunk_index + 1], 3 * edge_count);
+
+			for (; token_index < token_end; token_index++)
+			{
+				size_t edge_index = token_index / 3;
+				bool is_successful = false;
+
+				switch (token_index % 3)
+				{
+					case 0:
+						is_successful = ParseToken(
+							chunk_current, chunk_end, begin_indexes[edge_index])
+							&& begin_indexes[edge_index] < vertex_count;
+						break;
+					case 1:
+						is_successful = ParseToken(
+							chunk_current, chunk_end, end_indexes[edge_index])
+							&& end_indexes[edge_index] < vertex_count;
+						break;
+					case 2:
+						is_successful = ParseToken(
+							chunk_current, chunk_end, edge_costs[edge_index]);
+						break;
+				}
+
+				if (!is_successful)
+				{
+					is_failed.store(true, std::memory_order_relaxed);
+					return;
+				}
+			}
+		});
+
+	if (is_failed.load())
+	{
+		return false;
+	}
+
+	// ͳƸڽӱ
+	vector<atomic<size_t>> positions(vertex_count);
+
+	run_range(edge_count, [&](size_t, size_t range_begin, size_t range_end)
+		{
+			for (size_t i = range_begin; i < range_end; i++)
+			{
+				positions[begin_indexes[i]].fetch_add(1, std::memory_order_relaxed);
+
+				if (!is_directed)
+				{
+					positions[end_indexes[i]].fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		});
+
+	vector<size_t> offsets(vertex_count + 1, 0);
+
+	for (size_t i = 0; i < vertex_count; i++)
+	{
+		offsets[i + 1] = offsets[i] + positions[i].load(std::memory_order_relaxed);
+		positions[i].store(offsets[i], std::memory_order_relaxed);
+	}
+
+	const size_t adjacency_count = offsets[vertex_count];
+
+	vector<size_t> adj_vertex_indexes(adjacency_count);
+	vector<TE> costs(adjacency_count);
+	// ߳дʱڵ˳ȷÿĿʱĴд󰴼ָ˳
+	// Ϊ 2 *  + ǷΪͼķĿ
+	vector<size_t> order_keys(chunk_count > 1 ? adjacency_count : 0);
+
+	run_range(edge_count, [&](size_t, size_t range_begin, size_t range_end)
+		{
+			for (size_t i = range_begin; i < range_end; i++)
+			{
+				size_t begin_position = positions[begin_indexes[i]].fetch_add(
+					1, std::memory_order_relaxed);
+				adj_vertex_indexes[begin_position] = end_indexes[i];
+				costs[begin_position] = edge_costs[i];
+
+				if (chunk_count > 1)
+				{
+					order_keys[begin_position] = 2 * i;
+				}
+
+				if (!is_directed)
+				{
+					size_t end_position = positions[end_indexes[i]].fetch_add(
+						1, std::memory_order_relaxed);
+					adj_vertex_indexes[end_position] = begin_indexes[i];
+					costs[end_position] = edge_costs[i];
+
+					if (chunk_count > 1)
+					{
+						order_keys[end_position] = 2 * i + 1;
+					}
+				}
+			}
+		});
+
+	if (chunk_count > 1)
+	{
+		run_range(vertex_count, [&](size_t, size_t range_begin, size_t range_end)
+			{
+				vector<tuple<size_t, size_t, TE>> segment;
+
+				for (size_t i = range_begin; i < range_end; i++)
+				{
+					if (std::is_sorted(
+						order_keys.begin() + offsets[i],
+						order_keys.begin() + offsets[i + 1]))
+					{
+						continue;
+					}
+
+					segment.clear();
+
+					for (size_t j = offsets[i]; j < offsets[i + 1]; j++)
+					{
+						segment.emplace_back(order_keys[j], adj_vertex_indexes[j], costs[j]);
+					}
+
+					std::sort(segment.begin(), segment.end(),
+						[](const auto& lhs, const auto& rhs)
+						{
+							return get<0>(lhs) < get<0>(rhs);
+						});
+
+					for (size_t j = offsets[i]; j < offsets[i + 1]; j++)
+					{
+						adj_vertex_indexes[j] = get<1>(segment[j - offsets[i]]);
+						costs[j] = get<2>(segment[j - offsets[i]]);
+					}
+				}
+			});
+	}
+
+	graph.BuildGraph(
+		std::move(vertexes),
+		std::move(offsets),
+		std::move(adj_vertex_indexes),
+		std::move(costs),
+		edge_count);
+
+	return true;
+}
@@ -0,0 +1,255 @@
+#pragma once
+
+#include <vector>
+#include <limits>
+#include <utility>
+#include <algorithm>
+
+using std::vector;
+using std::numeric_limits;
+
+// dС
+// ģTKey: ; kArity: ÿӽ
+// еԪ[0, capacity)ڵ±꣬ͨpositions_O(1)ҵĳԪڶеλã
+// Ӷ֧DijkstraPrim㷨DecreaseKey
+// Ԫ±ֱУˡ˱Ƚʱֻʼ飻
+// ȣ4ѵ߼룬һȫӽͨλͬһڡ
+template<typename TKey, size_t kArity = 4>
+class IndexedDAryHeap final
+{
+private:
+	static constexpr size_t kNotInHeap = numeric_limits<size_t>::max();
+
+	// λôŵļԪ±
+	vector<TKey> heap_keys_;
+	vector<size_t> heap_elements_;
+	// positions_[e]ΪԪeڶеλãڶʱΪkNotInHeap
+	vector<size_t> positions_;
+
+	void MoveTo(size_t heap_position, TKey&& key, size_t element);
+	void SiftUp(size_t heap_position);
+	void SiftDown(size_t heap_position);
+
+public:
+	IndexedDAryHeap() = default;
+	explicit IndexedDAryHeap(size_t capacity);
+	~IndexedDAryHeap() = default;
+
+	// ԱResetնѣԪ±ȡֵΧΪ[0, capacity)
+	void Reset(size_t capacity);
+
+	bool IsEmpty() const;
+	size_t GetSize() const;
+	bool Contains(size_t element) const;
+
+	// ԱGetKeyȡԪصļ
+	const TKey& GetKey(size_t element) const;
+
+	const TKey& GetTopKey() const;
+	size_t GetTopElement() const;
+
+	// ԱPush벻ڶеԪ
+	void Push(size_t element, const TKey& key);
+
+	// ԱDecreaseKeyѶԪصļСΪkey
+	void DecreaseKey(size_t element, const TKey& key);
+
+	// ԱPushOrDecreaseKeyԪزڶʱ룻ڶkeyСʱС
+	// С˼ʱtrue
+	bool PushOrDecreaseKey(size_t element, const TKey& key);
+
+	// ԱPopɾСԪز±
+	size_t Pop();
+};
+
+template<typename TKey, size_t kArity>
+IndexedDAryHeap<TKey, kArity>::IndexedDAryHeap(size_t capacity)
+{
+	Reset(capacity);
+}
+
+template<typename TKey, size_t kArity>
+void IndexedDAryHeap<TKey, kArity>::Reset(size_t capacity)
+{
+	heap_keys_.clear();
+	heap_elements_.clear();
+	positions_.assign(capacity, kNotInHeap);
+}
+
+template<typename TKey, size_t kArity>
+bool IndexedDAryHeap<TKey, kArity>::IsEmpty() const
+{
+	return heap_elements_.empty();
+}
+
+template<typename TKey, size_t kArity>
+size_t IndexedDAryHeap<TKey, kArity>::GetSize() const
+{
+	return heap_elements_.size();
+}
+
+template<typename TKey, size_t kArity>
+bool IndexedDAryHeap<TKey, kArity>::Contains(size_t element) const
+{
+	return positions_[element] != kNotInHeap;
+}
+
+template<typename TKey, size_t kArity>
+const TKey& IndexedDAryHeap<TKey, kArity>::GetKey(size_t element) const
+{
+	return heap_keys_[positions_[element]];
+}
+
+template<typename TKey, size_t kArity>
+const TKey& IndexedDAryHeap<TKey, kArity>::GetTopKey() const
+{
+	return heap_keys_.front();
+}
+
+template<typename TKey, size_t kArity>
+size_t IndexedDAryHeap<TKey, kArity>::GetTopElement() const
+{
+	return heap_elements_.front();
+}
+
+template<typename TKey, size_t kArity>
+void IndexedDAryHeap<TKey, kArity>::MoveTo(
+	size_t heap_position, TKey&& key, size_t element)
+{
+	heap_keys_[heap_position] = std::move(key);
+	heap_elements_[heap_position] = element;
+	positions_[element] = heap_position;
+}
+
+template<typename TKey, size_t kArity>
+void IndexedDAryHeap<TKey, kArity>::SiftUp(size_t heap_position)
+{
+	// ȡ˵Ԫأ·ѽϴĸƣһԷλ
+	TKey key = std::move(heap_keys_[heap_position]);
+	size_t element = heap_elements_[heap_position];
+
+	while (heap_position > 0)
+	{
+		size_t parent_position = (heap_position - 1) / kArity;
+
+		if (!(key < heap_keys_[parent_position]))
+		{
+			break;
+		}
+
+		MoveTo(heap_position,
+			std::move(heap_keys_[parent_position]),
+			heap_elements_[parent_position]);
+
+		heap_position = parent_position;
+	}
+
+	MoveTo(heap_position, std::move(key), element);
+}
+
+template<typename TKey, size_t kArity>
+void IndexedDAryHeap<TKey, kArity>::SiftDown(size_t heap_position)
+{
+	const size_t heap_size = heap_elements_.size();
+
+	TKey key = std::move(heap_keys_[heap_position]);
+	size_t element = heap_elements_[heap_position];
+
+	while (true)
+	{
+		size_t first_child_position = heap_position * kArity + 1;
+
+		if (first_child_position >= heap_size)
+		{
+			break;
+		}
+
+		size_t last_child_position =
+			std::min(first_child_position + kArity, heap_size);
+
+		size_t min_child_position = first_child_position;
+
+		for (size_t i = first_child_position + 1; i < last_child_position; i++)
+		{
+			if (heap_keys_[i] < heap_keys_[min_child_position])
+			{
+				min_child_position = i;
+			}
+		}
+
+		if (!(heap_keys_[min_child_position] < key))
+		{
+			break;
+		}
+
+		MoveTo(heap_position,
+			std::move(heap_keys_[min_child_position]),
+			heap_elements_[min_child_position]);
+
+		heap_position = min_child_position;
+	}
+
+	MoveTo(heap_position, std::move(key), element);
+}
+
+template<typename TKey, size_t kArity>
+void IndexedDAryHeap<TKey, kArity>::Push(size_t element, const TKey& key)
+{
+	heap_keys_.push_back(key);
+	heap_elements_.push_back(element);
+	positions_[element] = heap_elements_.size() - 1;
+
+	SiftUp(heap_elements_.size() - 1);
+}
+
+template<typename TKey, size_t kArity>
+void IndexedDAryHeap<TKey, kArity>::DecreaseKey(size_t element, const TKey& key)
+{
+	size_t heap_position = positions_[element];
+
+	heap_keys_[heap_position] = key;
+
+	SiftUp(heap_position);
+}
+
+template<typename TKey, size_t kArity>
+bool IndexedDAryHeap<TKey, kArity>::PushOrDecreaseKey(size_t element, const TKey& key)
+{
+	if (!Contains(element))
+	{
+		Push(element, key);
+		return true;
+	}
+
+	if (key < GetKey(element))
+	{
+		DecreaseKey(element, key);
+		return true;
+	}
+
+	return false;
+}
+
+template<typename TKey, size_t kArity>
+size_t IndexedDAryHeap<TKey, kArity>::Pop()
+{
+	size_t top_element = heap_elements_.front();
+	positions_[top_element] = kNotInHeap;
+
+	if (heap_elements_.size() > 1)
+	{
+		heap_keys_.front() = std::move(heap_keys_.back());
+		heap_elements_.front() = heap_elements_.back();
+		positions_[heap_elements_.front()] = 0;
+	}
+
+	heap_keys_.pop_back();
+	heap_elements_.pop_back();
+
+	if (!heap_elements_.empty())
+	{
+		SiftDown(0);
+	}
+
+	return top_element;
+}
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using std::string;
+
+// ֻڴӳļ
+// 򿪺ļֱӳ䵽̵ַռ䣬ɲϵͳҳ
+// 򿪵ĿļС޹ءʱӳ䡣
+// ļ޷ӳ䣬ȻɹʱGetDataؿָ룬GetSize0
+class MappedFile final
+{
+private:
+	const char* data_ = nullptr;
+	size_t size_ = 0;
+
+#ifdef _WIN32
+	HANDLE file_handle_ = INVALID_HANDLE_VALUE;
+	HANDLE mapping_handle_ = nullptr;
+#else
+	int file_descriptor_ = -1;
+#endif
+
+public:
+	MappedFile() = default;
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	// ԱOpenӳļɹʱtrue
+	bool Open(const string& file_name);
+
+	// ԱCloseӳ䲢رļ
+	void Close();
+
+	const char* GetData() const;
+	size_t GetSize() const;
+};
+
+inline MappedFile::~MappedFile()
+{
+	Close();
+}
+
+inline bool MappedFile::Open(const string& file_name)
+{
+	Close();
+
+#ifdef _WIN32
+	file_handle_ = CreateFileA(
+		file_name.c_str(),
+		GENERIC_READ,
+		FILE_SHARE_READ,
+		nullptr,
+		OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS,
+		nullptr);
+
+	if (file_handle_ == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER file_size;
+
+	if (!GetFileSizeEx(file_handle_, &file_size))
+	{
+		Close();
+		return false;
+	}
+
+	if (file_size.QuadPart == 0)
+	{
+		return true;
+	}
+
+	mapping_handle_ = CreateFileMappingA(
+		file_handle_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	if (mapping_handle_ == nullptr)
+	{
+		Close();
+		return false;
+	}
+
+	data_ = static_cast<const char*>(
+		MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0));
+
+	if (data_ == nullptr)
+	{
+		Close();
+		return false;
+	}
+
+	size_ = static_cast<size_t>(file_size.QuadPart);
+#else
+	file_descriptor_ = open(file_name.c_str(), O_RDONLY);
+
+	if (file_descriptor_ < 0)
+	{
+		return false;
+	}
+
+	struct stat file_status;
+
+	if (fstat(file_descriptor_, &file_status) != 0)
+	{
+		Close();
+		return false;
+	}
+
+	if (file_status.st_size == 0)
+	{
+		return true;
+	}
+
+	void* mapped_address = mmap(
+		nullptr,
+		static_cast<size_t>(file_status.st_size),
+		PROT_READ,
+		MAP_PRIVATE,
+		file_descriptor_,
+		0);
+
+	if (mapped_address == MAP_FAILED)
+	{
+		Close();
+		return false;
+	}
+
+	data_ = static_cast<const char*>(mapped_address);
+	size_ = static_cast<size_t>(file_status.st_size);
+#endif
+
+	return true;
+}
+
+inline void MappedFile::Close()
+{
+#ifdef _WIN32
+	if (data_ != nullptr)
+	{
+		UnmapViewOfFile(data_);
+	}
+
+	if (mapping_handle_ != nullptr)
+	{
+		CloseHandle(mapping_handle_);
+		mapping_handle_ = nullptr;
+	}
+
+	if (file_handle_ != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(file_handle_);
+		file_handle_ = INVALID_HANDLE_VALUE;
+	}
+#else
+	if (data_ != nullptr)
+	{
+		munmap(const_cast<char*>(data_), size_);
+	}
+
+	if (file_descriptor_ >= 0)
+	{
+		close(file_descriptor_);
+		file_descriptor_ = -1;
+	}
+#endif
+
+	data_ = nullptr;
+	size_ = 0;
+}
+
+inline const char* MappedFile::GetData() const
+{
+	return data_;
+}
+
+inline size_t MappedFile::GetSize() const
+{
+	return size_;
+}
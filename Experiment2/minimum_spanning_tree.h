@@ -0,0 +1,507 @@
+#pragma once
+
+#include <iostream>
+#include <format>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <limits>
+#include <utility>
+#include <algorithm>
+
+#include "disjoint_set.h"
+#include "indexed_dary_heap.h"
+#include "thread_pool.h"
+
+using std::cout;
+using std::endl;
+
+using std::format;
+
+using std::string;
+using std::vector;
+using std::pair;
+using std::atomic;
+using std::numeric_limits;
+
+enum class SpanningTreeAlgorithm
+{
+	KRUSKAL,
+	PRIM,
+	BORUVKA
+};
+
+// ȨߣԼbegin_vertex_index < end_vertex_index
+template<typename TE>
+struct WeightedEdge final
+{
+	size_t begin_vertex_index = 0;
+	size_t end_vertex_index = 0;
+	TE cost = 0;
+};
+
+// Сɭֽ
+// ģTE: Ȩ
+// ͼͨʱΪÿͨһСtree_countΪĿ㣩
+template<typename TE>
+class MinimumSpanningTreeResults final
+{
+public:
+	SpanningTreeAlgorithm algorithm = SpanningTreeAlgorithm::KRUSKAL;
+	vector<WeightedEdge<TE>> edges;
+	TE total_cost = 0;
+	size_t tree_count = 0;
+
+	MinimumSpanningTreeResults() = default;
+	~MinimumSpanningTreeResults() = default;
+
+	// ̬ԱģDisplayMinimumSpanningTreeResultsչʾСɭ֣
+	// ͨgraph.GetVertexDataȡ
+	template<typename TGraph>
+	static void DisplayMinimumSpanningTreeResults(
+		const MinimumSpanningTreeResults<TE>& results,
+		const TGraph& graph)
+	{
+		const char* algorithm_name = "KRUSKAL";
+
+		if (results.algorithm == SpanningTreeAlgorithm::PRIM)
+		{
+			algorithm_name = "PRIM";
+		}
+		else if (results.algorithm == SpanningTreeAlgorithm::BORUVKA)
+		{
+			algorithm_name = "BORUVKA";
+		}
+
+		cout << format("[MINIMUM SPANNING FOREST({0})]", algorithm_name) << endl;
+		cout << "TOTAL COST: " << results.total_cost << endl;
+		cout << "NUMBER OF TREE(s): " << results.tree_count << endl;
+		cout << "TREE EDGES: ";
+
+		for (auto& i : results.edges)
+		{
+			cout << format("([{0}]{1}-[{2}]{3}:{4}) ",
+				i.begin_vertex_index,
+				graph.GetVertexData(i.begin_vertex_index),
+				i.end_vertex_index,
+				graph.GetVertexData(i.end_vertex_index),
+				i.cost);
+		}
+
+		cout << endl << endl;
+	}
+};
+
+// Сɭ
+// ģTE: Ȩ
+// ʱṩForEachAdjacentEdgeԱģͼȡȫߣΪߣ
+// (u,v)(v,u)ϲΪһͬһԶжʱֻȨСߣԻԡ
+// ͼ˵õͼСɭ֡
+// Ȩͬı߰(begin_vertex_index, end_vertex_index)
+// 㷨ݴʹͬһȫڱȨظʱҲõͬһСɭ֡
+template<typename TE>
+class MinimumSpanningTree final
+{
+private:
+	static constexpr size_t kNoEdge = numeric_limits<size_t>::max();
+
+	size_t vertex_count_ = 0;
+
+	// ȥغߣ(begin_vertex_index, end_vertex_index)
+	vector<WeightedEdge<TE>> edges_;
+
+	// ˫洢ڽӱadj_edge_indexes_ΪӦedges_е±꣬Prim㷨ʹ
+	vector<size_t> adj_offsets_;
+	vector<size_t> adj_vertex_indexes_;
+	vector<size_t> adj_edge_indexes_;
+
+	// ԱIsLighterEdge(Ȩ, ±)Ƚ
+	bool IsLighterEdge(size_t first_edge_index, size_t second_edge_index) const;
+
+	// ԱSortEdgeIndexesѱ±갴IsLighterEdge
+	// ̳߳ʱ߳ȸһΣֲе鲢
+	void SortEdgeIndexes(vector<size_t>& edge_indexes, ThreadPool* thread_pool) const;
+
+	// ԱMakeResultsѡı±ɽ
+	MinimumSpanningTreeResults<TE> MakeResults(
+		const vector<size_t>& tree_edge_indexes,
+		SpanningTreeAlgorithm algorithm) const;
+
+public:
+	template<typename TGraph>
+	explicit MinimumSpanningTree(const TGraph& graph);
+
+	~MinimumSpanningTree() = default;
+
+	// ԱKruskalȨɨȫߣԲ鼯жǷɻ
+	// thread_poolΪʱ
+	MinimumSpanningTreeResults<TE> Kruskal(ThreadPool* thread_pool = nullptr) const;
+
+	// ԱPrim4ʵֵPrim㷨ÿͨһ
+	// ԪΪʺڽӾĳͼܿΪO(E log V)
+	MinimumSpanningTreeResults<TE> Prim() const;
+
+	// ԱBoruvka̵߳Boruvka㷨
+	// ÿֲɨ֮ͨıߣԭCASΪÿ¼ĳߣ
+	// ٰѡıȫɭֲϲÿַټ룬log2(V)֡
+	// ͬһеıɨʱ˺ֲɨ衣
+	MinimumSpanningTreeResults<TE> Boruvka(ThreadPool& thread_pool) const;
+};
+
+template<typename TE>
+template<typename TGraph>
+MinimumSpanningTree<TE>::MinimumSpanningTree(const TGraph& graph) :
+	vertex_count_(graph.vertex_count)
+{
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		graph.ForEachAdjacentEdge(i, [&](size_t adj_vertex_index, const TE& cost)
+			{
+				if (adj_vertex_index == i)
+				{
+					return;
+				}
+
+				edges_.push_back({
+					std::min(i, adj_vertex_index),
+					std::max(i, adj_vertex_index),
+					cost });
+			});
+	}
+
+	std::sort(edges_.begin(), edges_.end(),
+		[](const WeightedEdge<TE>& first_edge, const WeightedEdge<TE>& second_edge)
+		{
+			if (first_edge.begin_vertex_index != second_edge.begin_vertex_index)
+			{
+				return first_edge.begin_vertex_index < second_edge.begin_vertex_index;
+			}
+
+			if (first_edge.end_vertex_index != second_edge.end_vertex_index)
+			{
+				return first_edge.end_vertex_index < second_edge.end_vertex_index;
+			}
+
+			return first_edge.cost < second_edge.cost;
+		});
+
+	// ͬԵıУǰıȨС
+	edges_.erase(std::unique(edges_.begin(), edges_.end(),
+		[](const WeightedEdge<TE>& first_edge, const WeightedEdge<TE>& second_edge)
+		{
+			return first_edge.begin_vertex_index == second_edge.begin_vertex_index
+				&& first_edge.end_vertex_index == second_edge.end_vertex_index;
+		}), edges_.end());
+
+	adj_offsets_.assign(vertex_count_ + 1, 0);
+
+	for (auto& i : edges_)
+	{
+		adj_offsets_[i.begin_vertex_index + 1]++;
+		adj_offsets_[i.end_vertex_index + 1]++;
+	}
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		adj_offsets_[i + 1] += adj_offsets_[i];
+	}
+
+	adj_vertex_indexes_.resize(adj_offsets_[vertex_count_]);
+	adj_edge_indexes_.resize(adj_offsets_[vertex_count_]);
+
+	vector<size_t> insert_positions(adj_offsets_.begin(), adj_offsets_.end() - 1);
+
+	for (size_t i = 0; i < edges_.size(); i++)
+	{
+		size_t& begin_position = insert_positions[edges_[i].begin_vertex_index];
+		adj_vertex_indexes_[begin_position] = edges_[i].end_vertex_index;
+		adj_edge_indexes_[begin_position] = i;
+		begin_position++;
+
+		size_t& end_position = insert_positions[edges_[i].end_vertex_index];
+		adj_vertex_indexes_[end_position] = edges_[i].begin_vertex_index;
+		adj_edge_indexes_[end_position] = i;
+		end_position++;
+	}
+}
+
+template<typename TE>
+bool MinimumSpanningTree<TE>::IsLighterEdge(
+	size_t first_edge_index, size_t second_edge_index) const
+{
+	const TE& first_cost = edges_[first_edge_index].cost;
+	const TE& second_cost = edges_[second_edge_index].cost;
+
+	if (first_cost != second_cost)
+	{
+		return first_cost < second_cost;
+	}
+
+	return first_edge_index < second_edge_index;
+}
+
+template<typename TE>
+void MinimumSpanningTree<TE>::SortEdgeIndexes(
+	vector<size_t>& edge_indexes, ThreadPool* thread_pool) const
+{
+	auto is_lighter = [this](size_t first_edge_index, size_t second_edge_index)
+	{
+		return IsLighterEdge(first_edge_index, second_edge_index);
+	};
+
+	if (thread_pool == nullptr || thread_pool->GetThreadCount() == 1)
+	{
+		std::sort(edge_indexes.begin(), edge_indexes.end(), is_lighter);
+		return;
+	}
+
+	const size_t thread_count = thread_pool->GetThreadCount();
+	const size_t total_count = edge_indexes.size();
+
+	// ParallelForͬĵȷַʽrun_boundaries[t]Ϊtε
+	vector<size_t> run_boundaries(thread_count + 1);
+
+	for (size_t i = 0; i <= thread_count; i++)
+	{
+		run_boundaries[i] = total_count * i / thread_count;
+	}
+
+	thread_pool->ParallelFor(0, total_count,
+		[&](size_t, size_t chunk_begin, size_t chunk_end)
+		{
+			std::sort(edge_indexes.begin() + chunk_begin,
+				edge_indexes.begin() + chunk_end,
+				is_lighter);
+		});
+
+	// ÿְڵι鲢ΪһΣ֮以ཻɲн
+	for (size_t run_width = 1; run_width < thread_count; run_width *= 2)
+	{
+		const size_t pair_count =
+			(thread_count + 2 * run_width - 1) / (2 * run_width);
+
+		thread_pool->ParallelFor(0, pair_count,
+			[&](size_t, size_t chunk_begin, size_t chunk_end)
+			{
+				for (size_t i = chunk_begin; i < chunk_end; i++)
+				{
+					size_t first_run = i * 2 * run_width;
+					size_t middle_run = std::min(first_run + run_width, thread_count);
+					size_t last_run = std::min(first_run + 2 * run_width, thread_count);
+
+					std::inplace_merge(
+						edge_indexes.begin() + run_boundaries[first_run],
+						edge_indexes.begin() + run_boundaries[middle_run],
+						edge_indexes.begin() + run_boundaries[last_run],
+						is_lighter);
+				}
+			});
+	}
+}
+
+template<typename TE>
+MinimumSpanningTreeResults<TE> MinimumSpanningTree<TE>::MakeResults(
+	const vector<size_t>& tree_edge_indexes,
+	SpanningTreeAlgorithm algorithm) const
+{
+	MinimumSpanningTreeResults<TE> results;
+	results.algorithm = algorithm;
+	results.edges.reserve(tree_edge_indexes.size());
+
+	for (auto i : tree_edge_indexes)
+	{
+		results.edges.push_back(edges_[i]);
+		results.total_cost += edges_[i].cost;
+	}
+
+	results.tree_count = vertex_count_ - tree_edge_indexes.size();
+
+	return results;
+}
+
+template<typename TE>
+MinimumSpanningTreeResults<TE> MinimumSpanningTree<TE>::Kruskal(
+	ThreadPool* thread_pool) const
+{
+	vector<size_t> edge_indexes(edges_.size());
+
+	for (size_t i = 0; i < edge_indexes.size(); i++)
+	{
+		edge_indexes[i] = i;
+	}
+
+	SortEdgeIndexes(edge_indexes, thread_pool);
+
+	DisjointSet disjoint_set(vertex_count_);
+	vector<size_t> tree_edge_indexes;
+
+	for (auto i : edge_indexes)
+	{
+		if (disjoint_set.Union(edges_[i].begin_vertex_index, edges_[i].end_vertex_index))
+		{
+			tree_edge_indexes.push_back(i);
+
+			// ɭֵıﵽ޺ı߶ɻ
+			if (tree_edge_indexes.size() + 1 == vertex_count_)
+			{
+				break;
+			}
+		}
+	}
+
+	return MakeResults(tree_edge_indexes, SpanningTreeAlgorithm::KRUSKAL);
+}
+
+template<typename TE>
+MinimumSpanningTreeResults<TE> MinimumSpanningTree<TE>::Prim() const
+{
+	// ѵļΪ(Ȩ, ±)IsLighterEdge˳һ
+	IndexedDAryHeap<pair<TE, size_t>> heap(vertex_count_);
+	vector<bool> is_in_tree(vertex_count_, false);
+	vector<size_t> tree_edge_indexes;
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		if (is_in_tree[i])
+		{
+			continue;
+		}
+
+		// ±СδΪһ
+		is_in_tree[i] = true;
+		size_t current_vertex_index = i;
+
+		while (true)
+		{
+			for (size_t j = adj_offsets_[current_vertex_index];
+				j < adj_offsets_[current_vertex_index + 1];
+				j++)
+			{
+				size_t adj_vertex_index = adj_vertex_indexes_[j];
+
+				if (!is_in_tree[adj_vertex_index])
+				{
+					heap.PushOrDecreaseKey(adj_vertex_index,
+						{ edges_[adj_edge_indexes_[j]].cost, adj_edge_indexes_[j] });
+				}
+			}
+
+			if (heap.IsEmpty())
+			{
+				break;
+			}
+
+			tree_edge_indexes.push_back(heap.GetTopKey().second);
+			current_vertex_index = heap.Pop();
+			is_in_tree[current_vertex_index] = true;
+		}
+	}
+
+	return MakeResults(tree_edge_indexes, SpanningTreeAlgorithm::PRIM);
+}
+
+template<typename TE>
+MinimumSpanningTreeResults<TE> MinimumSpanningTree<TE>::Boruvka(
+	ThreadPool& thread_pool) const
+{
+	const size_t thread_count = thread_pool.GetThreadCount();
+
+	// components[v]ΪvڷĴ㣬ÿֺϲͳһ
+	vector<size_t> components(vertex_count_);
+	// lightest_edges[c]Ϊcĳ±
+	vector<atomic<size_t>> lightest_edges(vertex_count_);
+	DisjointSet disjoint_set(vertex_count_);
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		components[i] = i;
+		lightest_edges[i].store(kNoEdge, std::memory_order_relaxed);
+	}
+
+	vector<size_t> active_edge_indexes(edges_.size());
+
+	for (size_t i = 0; i < active_edge_indexes.size(); i++)
+	{
+		active_edge_indexes[i] = i;
+	}
+
+	// ߳ڱɨбı
+	vector<vector<size_t>> thread_kept_edge_indexes(thread_count);
+	vector<size_t> tree_edge_indexes;
+
+	auto offer_edge = [&](size_t component, size_t edge_index)
+	{
+		size_t current_edge_index = lightest_edges[component].load(std::memory_order_relaxed);
+
+		while (current_edge_index == kNoEdge
+			|| IsLighterEdge(edge_index, current_edge_index))
+		{
+			if (lightest_edges[component].compare_exchange_weak(
+				current_edge_index, edge_index, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+	};
+
+	while (!active_edge_indexes.empty())
+	{
+		thread_pool.ParallelFor(0, active_edge_indexes.size(),
+			[&](size_t thread_index, size_t chunk_begin, size_t chunk_end)
+			{
+				auto& local_kept_edge_indexes = thread_kept_edge_indexes[thread_index];
+
+				for (size_t i = chunk_begin; i < chunk_end; i++)
+				{
+					size_t edge_index = active_edge_indexes[i];
+					size_t begin_component = components[edges_[edge_index].begin_vertex_index];
+					size_t end_component = components[edges_[edge_index].end_vertex_index];
+
+					if (begin_component == end_component)
+					{
+						continue;
+					}
+
+					local_kept_edge_indexes.push_back(edge_index);
+
+					offer_edge(begin_component, edge_index);
+					offer_edge(end_component, edge_index);
+				}
+			});
+
+		active_edge_indexes.clear();
+
+		for (auto& i : thread_kept_edge_indexes)
+		{
+			active_edge_indexes.insert(active_edge_indexes.end(), i.begin(), i.end());
+			i.clear();
+		}
+
+		// ȫ¸߹ɵͼ޻ѡͬһʱUnionfalse
+		for (size_t i = 0; i < vertex_count_; i++)
+		{
+			size_t edge_index = lightest_edges[i].load(std::memory_order_relaxed);
+
+			if (edge_index == kNoEdge)
+			{
+				continue;
+			}
+
+			lightest_edges[i].store(kNoEdge, std::memory_order_relaxed);
+
+			if (disjoint_set.Union(
+				edges_[edge_index].begin_vertex_index,
+				edges_[edge_index].end_vertex_index))
+			{
+				tree_edge_indexes.push_back(edge_index);
+			}
+		}
+
+		for (size_t i = 0; i < vertex_count_; i++)
+		{
+			components[i] = disjoint_set.Find(i);
+		}
+	}
+
+	return MakeResults(tree_edge_indexes, SpanningTreeAlgorithm::BORUVKA);
+}
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <vector>
+#include <tuple>
+#include <atomic>
+#include <limits>
+
+#include "traversal_results.h"
+#include "thread_pool.h"
+
+using std::vector;
+using std::tuple;
+using std::get;
+using std::atomic;
+using std::numeric_limits;
+
+// ̰߳ͬĹȱ
+// ģTE: Ȩ
+// ʱṩForEachAdjacentEdgeԱģͼиƳ洢ĳ߱
+// ÿһǰرȷָ̳߳еĸ߳չʱԭӲռ
+// ̰߳·ֵĶдԼĻĩ̱߳˳ƴΪһǰء
+// ѭͼBFSͬ±˳ÿδʶ㿪ʼͨ
+template<typename TE>
+class ParallelBFS final
+{
+private:
+	size_t vertex_count_ = 0;
+
+	vector<size_t> out_offsets_;
+	vector<size_t> out_vertex_indexes_;
+	vector<TE> out_costs_;
+
+	ThreadPool& thread_pool_;
+
+	// ǰسڴֵʱڵֱ߳չС߳ͬ
+	static constexpr size_t kParallelEdgeThreshold = 4096;
+
+	void BFSImp(
+		size_t root_vertex_index,
+		int& current_bfs_number,
+		vector<atomic<bool>>& is_visited,
+		vector<atomic<size_t>>& parent_positions,
+		vector<vector<size_t>>& thread_next_frontiers,
+		vector<vector<tuple<size_t, size_t, TE>>>& thread_tree_edges,
+		bool is_deterministic,
+		TraversalVisitor<TE>& visitor) const;
+
+public:
+	template<typename TGraph>
+	ParallelBFS(const TGraph& graph, ThreadPool& thread_pool);
+
+	~ParallelBFS() = default;
+
+	// ԱBFSͼвйȱ
+	// is_deterministicΪtrueʱÿĸȡǰλǰڽӶ㣬
+	// ͬһӶ㰴ڽ˳У뵥߳BFSȫͬ
+	// Ϊfalseʱֻһԭռٶȸ죬ͬһڵ˳̵߳йء
+	void BFS(TraversalVisitor<TE>& visitor, bool is_deterministic) const;
+};
+
+template<typename TE>
+template<typename TGraph>
+ParallelBFS<TE>::ParallelBFS(const TGraph& graph, ThreadPool& thread_pool) :
+	vertex_count_(graph.vertex_count), thread_pool_(thread_pool)
+{
+	out_offsets_.assign(vertex_count_ + 1, 0);
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		out_offsets_[i + 1] = out_offsets_[i];
+
+		graph.ForEachAdjacentEdge(i, [&](size_t adj_vertex_index, const TE& cost)
+			{
+				out_vertex_indexes_.push_back(adj_vertex_index);
+				out_costs_.push_back(cost);
+				out_offsets_[i + 1]++;
+			});
+	}
+}
+
+template<typename TE>
+void ParallelBFS<TE>::BFS(
+	TraversalVisitor<TE>& visitor, bool is_deterministic) const
+{
+	vector<atomic<bool>> is_visited(vertex_count_);
+	// ȷģʽ£¼ÿֶǰλСĸ
+	vector<atomic<size_t>> parent_positions(vertex_count_);
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		is_visited[i].store(false, std::memory_order_relaxed);
+		parent_positions[i].store(
+			numeric_limits<size_t>::max(), std::memory_order_relaxed);
+	}
+
+	// ̵߳һǰػ߻ڸͨ临
+	vector<vector<size_t>> thread_next_frontiers(thread_pool_.GetThreadCount());
+	vector<vector<tuple<size_t, size_t, TE>>> thread_tree_edges(
+		thread_pool_.GetThreadCount());
+
+	int bfs_number_initial = 0;
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		if (!is_visited[i].load(std::memory_order_relaxed))
+		{
+			BFSImp(i, bfs_number_initial,
+				is_visited, parent_positions,
+				thread_next_frontiers, thread_tree_edges,
+				is_deterministic, visitor);
+		}
+	}
+}
+
+template<typename TE>
+void ParallelBFS<TE>::BFSImp(
+	size_t root_vertex_index,
+	int& current_bfs_number,
+	vector<atomic<bool>>& is_visited,
+	vector<atomic<size_t>>& parent_positions,
+	vector<vector<size_t>>& thread_next_frontiers,
+	vector<vector<tuple<size_t, size_t, TE>>>& thread_tree_edges,
+	bool is_deterministic,
+	TraversalVisitor<TE>& visitor) const
+{
+	const size_t thread_count = thread_pool_.GetThreadCount();
+
+	vector<size_t> frontier{ root_vertex_index };
+	vector<size_t> next_frontier;
+
+	is_visited[root_vertex_index].store(true, std::memory_order_relaxed);
+
+	// Ƿִȡĵһ
+	bool is_parent_proposed = false;
+
+	// ȷģʽĵһ飺ΪÿδڽӶȡλСĸ
+	auto propose_parents = [&](size_t, size_t chunk_begin, size_t chunk_end)
+	{
+		for (size_t i = chunk_begin; i < chunk_end; i++)
+		{
+			size_t current_vertex_index = frontier[i];
+
+			for (size_t j = out_offsets_[current_vertex_index];
+				j < out_offsets_[current_vertex_index + 1];
+				j++)
+			{
+				size_t adj_vertex_index = out_vertex_indexes_[j];
+
+				if (is_visited[adj_vertex_index].load(std::memory_order_relaxed))
+				{
+					continue;
+				}
+
+				size_t current_position =
+					parent_positions[adj_vertex_index].load(std::memory_order_relaxed);
+
+				while (i < current_position
+					&& !parent_positions[adj_vertex_index].compare_exchange_weak(
+						current_position, i, std::memory_order_relaxed))
+				{
+				}
+			}
+		}
+	};
+
+	// ռʱǲ¼̻߳ȷģʽֻȡʸı߲ռ
+	auto claim_children = [&](size_t thread_index, size_t chunk_begin, size_t chunk_end)
+	{
+		auto& local_next_frontier = thread_next_frontiers[thread_index];
+		auto& local_tree_edges = thread_tree_edges[thread_index];
+
+		for (size_t i = chunk_begin; i < chunk_end; i++)
+		{
+			size_t current_vertex_index = frontier[i];
+
+			for (size_t j = out_offsets_[current_vertex_index];
+				j < out_offsets_[current_vertex_index + 1];
+				j++)
+			{
+				size_t adj_vertex_index = out_vertex_indexes_[j];
+
+				if (is_visited[adj_vertex_index].load(std::memory_order_relaxed))
+				{
+					continue;
+				}
+
+				if (is_parent_proposed
+					&& parent_positions[adj_vertex_index].load(
+						std::memory_order_relaxed) != i)
+				{
+					continue;
+				}
+
+				if (!is_visited[adj_vertex_index].exchange(
+					true, std::memory_order_relaxed))
+				{
+					local_next_frontier.push_back(adj_vertex_index);
+					local_tree_edges.emplace_back(
+						current_vertex_index, adj_vertex_index, out_costs_[j]);
+				}
+			}
+		}
+	};
+
+	while (!frontier.empty())
+	{
+		size_t frontier_edge_count = 0;
+
+		for (auto i : frontier)
+		{
+			visitor.OnVertexVisited(i, current_bfs_number++);
+			frontier_edge_count += out_offsets_[i + 1] - out_offsets_[i];
+		}
+
+		if (frontier_edge_count < kParallelEdgeThreshold || thread_count == 1)
+		{
+			// ߳չʱȻǰ˳ռһ
+			is_parent_proposed = false;
+			claim_children(0, 0, frontier.size());
+		}
+		else
+		{
+			is_parent_proposed = is_deterministic;
+
+			if (is_parent_proposed)
+			{
+				thread_pool_.ParallelFor(0, frontier.size(), propose_parents);
+			}
+
+			thread_pool_.ParallelFor(0, frontier.size(), claim_children);
+		}
+
+		next_frontier.clear();
+
+		// ߳tǰеt䣬̱߳ƴӼǰ˳
+		for (size_t i = 0; i < thread_count; i++)
+		{
+			next_frontier.insert(next_frontier.end(),
+				thread_next_frontiers[i].begin(), thread_next_frontiers[i].end());
+
+			for (auto& j : thread_tree_edges[i])
+			{
+				visitor.OnSpanningTreeEdge(get<0>(j), get<1>(j), get<2>(j));
+			}
+
+			thread_next_frontiers[i].clear();
+			thread_tree_edges[i].clear();
+		}
+
+		frontier.swap(next_frontier);
+	}
+}
@@ -0,0 +1,504 @@
+#pragma once
+
+#include <iostream>
+#include <format>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <limits>
+#include <algorithm>
+
+#include "indexed_dary_heap.h"
+#include "thread_pool.h"
+
+using std::cout;
+using std::endl;
+
+using std::format;
+
+using std::string;
+using std::vector;
+using std::atomic;
+using std::numeric_limits;
+
+enum class ShortestPathAlgorithm
+{
+	DIJKSTRA,
+	DELTA_STEPPING
+};
+
+// Դ·
+// ģTE: Ȩ
+// distances[v]ΪԴ㵽v̾룬ɴʱΪkInfinity
+// parents[v]Ϊ·vĸ㣬Դ벻ɴﶥΪkNoParent
+template<typename TE>
+class ShortestPathResults final
+{
+public:
+	static constexpr TE kInfinity = numeric_limits<TE>::max();
+	static constexpr size_t kNoParent = numeric_limits<size_t>::max();
+
+	ShortestPathAlgorithm algorithm = ShortestPathAlgorithm::DIJKSTRA;
+	size_t source_vertex_index = 0;
+	vector<TE> distances;
+	vector<size_t> parents;
+
+	ShortestPathResults() = default;
+	ShortestPathResults(
+		size_t vertex_count,
+		size_t source_vertex_index,
+		ShortestPathAlgorithm algorithm) :
+		algorithm(algorithm),
+		source_vertex_index(source_vertex_index),
+		distances(vertex_count, kInfinity),
+		parents(vertex_count, kNoParent)
+	{}
+
+	~ShortestPathResults() = default;
+
+	bool IsReachable(size_t vertex_index) const
+	{
+		return distances[vertex_index] != kInfinity;
+	}
+
+	// ԱGetPathظݣõԴ㵽target_vertex_indexĶУɴʱΪ
+	vector<size_t> GetPath(size_t target_vertex_index) const
+	{
+		vector<size_t> path;
+
+		if (!IsReachable(target_vertex_index))
+		{
+			return path;
+		}
+
+		for (size_t i = target_vertex_index; i != kNoParent; i = parents[i])
+		{
+			path.push_back(i);
+		}
+
+		std::reverse(path.begin(), path.end());
+
+		return path;
+	}
+
+	// ̬ԱģDisplayShortestPathResultsչʾ·
+	// ͨgraph.GetVertexDataȡ
+	template<typename TGraph>
+	static void DisplayShortestPathResults(
+		const ShortestPathResults<TE>& results,
+		const TGraph& graph)
+	{
+		cout << format("[SHORTEST PATHS({0}) FROM [{1}]{2}]",
+			results.algorithm == ShortestPathAlgorithm::DIJKSTRA ?
+			"DIJKSTRA" : "DELTA-STEPPING",
+			results.source_vertex_index,
+			graph.GetVertexData(results.source_vertex_index)) << endl;
+
+		cout << "DISTANCES: ";
+
+		for (size_t i = 0; i < results.distances.size(); i++)
+		{
+			if (results.IsReachable(i))
+			{
+				cout << format("([{0}]{1}:{2}) ",
+					i, graph.GetVertexData(i), results.distances[i]);
+			}
+			else
+			{
+				cout << format("([{0}]{1}:INF) ", i, graph.GetVertexData(i));
+			}
+		}
+
+		cout << endl;
+		cout << "SHORTEST PATH TREE EDGES: ";
+
+		for (size_t i = 0; i < results.parents.size(); i++)
+		{
+			if (results.parents[i] != kNoParent)
+			{
+				cout << format("([{0}]{1}-[{2}]{3}) ",
+					results.parents[i],
+					graph.GetVertexData(results.parents[i]),
+					i,
+					graph.GetVertexData(i));
+			}
+		}
+
+		cout << endl << endl;
+	}
+};
+
+// Դ·
+// ģTE: Ȩͣ߱ȨǸ
+// ʱṩForEachAdjacentEdgeԱģͼиƳ洢ĳ߱
+// ڽӱڽӾCSRִ洢ʽͼʹãҴ˺ɶͬһͼ⡣
+template<typename TE>
+class ShortestPaths final
+{
+private:
+	static constexpr size_t kNotQueued = numeric_limits<size_t>::max();
+
+	size_t vertex_count_ = 0;
+
+	vector<size_t> out_offsets_;
+	vector<size_t> out_vertex_indexes_;
+	vector<TE> out_costs_;
+
+	// ԱBuildParentsյ̾·
+	// һ鲢еΪÿѡȡϸСĽ±СΪ㣻
+	// ֻɱȨΪ0Ľ߲ܵĶڵڶдȷĶȫ
+	// Ȩʹɻ
+	void BuildParents(ShortestPathResults<TE>& results, ThreadPool& thread_pool) const;
+
+public:
+	template<typename TGraph>
+	explicit ShortestPaths(const TGraph& graph);
+
+	~ShortestPaths() = default;
+
+	// ԱGetDefaultDeltaȡDeltaSteppingĬͰȡȨƽֵ
+	TE GetDefaultDelta() const;
+
+	// ԱDijkstra4ʵֵDijkstra㷨
+	ShortestPathResults<TE> Dijkstra(size_t source_vertex_index) const;
+
+	// ԱDeltaSteppingеĦ-stepping㷨
+	// ѶΪdeltaͰδͰͰڷɳߣȨdelta
+	// ֱͰգһɳڱͰȫرߡԭCASȡСֵ¡
+	// ̾Dijkstraͬڶ·ʱѡȡDijkstraͬ
+	ShortestPathResults<TE> DeltaStepping(
+		size_t source_vertex_index,
+		TE delta,
+		ThreadPool& thread_pool) const;
+};
+
+template<typename TE>
+template<typename TGraph>
+ShortestPaths<TE>::ShortestPaths(const TGraph& graph) :
+	vertex_count_(graph.vertex_count)
+{
+	out_offsets_.assign(vertex_count_ + 1, 0);
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		out_offsets_[i + 1] = out_offsets_[i];
+
+		graph.ForEachAdjacentEdge(i, [&](size_t adj_vertex_index, const TE& cost)
+			{
+				out_vertex_indexes_.push_back(adj_vertex_index);
+				out_costs_.push_back(cost);
+				out_offsets_[i + 1]++;
+			});
+	}
+}
+
+template<typename TE>
+TE ShortestPaths<TE>::GetDefaultDelta() const
+{
+	TE cost_sum = 0;
+	size_t positive_cost_count = 0;
+
+	for (auto& i : out_costs_)
+	{
+		if (i > 0)
+		{
+			cost_sum += i;
+			positive_cost_count++;
+		}
+	}
+
+	if (positive_cost_count == 0)
+	{
+		return TE(1);
+	}
+
+	return std::max(
+		static_cast<TE>(cost_sum / static_cast<TE>(positive_cost_count)), TE(1));
+}
+
+template<typename TE>
+ShortestPathResults<TE> ShortestPaths<TE>::Dijkstra(size_t source_vertex_index) const
+{
+	ShortestPathResults<TE> results(
+		vertex_count_, source_vertex_index, ShortestPathAlgorithm::DIJKSTRA);
+
+	IndexedDAryHeap<TE> heap(vertex_count_);
+
+	results.distances[source_vertex_index] = 0;
+	heap.Push(source_vertex_index, 0);
+
+	while (!heap.IsEmpty())
+	{
+		TE current_distance = heap.GetTopKey();
+		size_t current_vertex_index = heap.Pop();
+
+		for (size_t i = out_offsets_[current_vertex_index];
+			i < out_offsets_[current_vertex_index + 1];
+			i++)
+		{
+			size_t adj_vertex_index = out_vertex_indexes_[i];
+			TE new_distance = current_distance + out_costs_[i];
+
+			if (new_distance < results.distances[adj_vertex_index])
+			{
+				results.distances[adj_vertex_index] = new_distance;
+				results.parents[adj_vertex_index] = current_vertex_index;
+
+				heap.PushOrDecreaseKey(adj_vertex_index, new_distance);
+			}
+		}
+	}
+
+	return results;
+}
+
+template<typename TE>
+ShortestPathResults<TE> ShortestPaths<TE>::DeltaStepping(
+	size_t source_vertex_index,
+	TE delta,
+	ThreadPool& thread_pool) const
+{
+	constexpr TE kInfinity = ShortestPathResults<TE>::kInfinity;
+
+	vector<atomic<TE>> distances(vertex_count_);
+
+	for (auto& i : distances)
+	{
+		i.store(kInfinity, std::memory_order_relaxed);
+	}
+
+	// ͰдĶ㣬ıͰеļ¼ϣʱ
+	vector<vector<size_t>> buckets;
+	// queued_buckets[v]Ϊvǰ¼ڵͰڱͬһͰظ¼
+	vector<size_t> queued_buckets(vertex_count_, kNotQueued);
+	// settled_buckets[v]ΪvһαĳͰѴ㼯ʱͰ
+	vector<size_t> settled_buckets(vertex_count_, kNotQueued);
+	// ߳һɳгɹ˾Ķ
+	vector<vector<size_t>> thread_updated_vertexes(thread_pool.GetThreadCount());
+
+	auto get_bucket_index = [&](TE distance)
+	{
+		return static_cast<size_t>(distance / delta);
+	};
+
+	auto enqueue = [&](size_t vertex_index)
+	{
+		size_t bucket_index = get_bucket_index(
+			distances[vertex_index].load(std::memory_order_relaxed));
+
+		if (queued_buckets[vertex_index] == bucket_index)
+		{
+			return;
+		}
+
+		if (bucket_index >= buckets.size())
+		{
+			buckets.resize(bucket_index + 1);
+		}
+
+		buckets[bucket_index].push_back(vertex_index);
+		queued_buckets[vertex_index] = bucket_index;
+	};
+
+	// ɳfrontierи߻رߣڵ߳аѾ뽵˵ĶͰ
+	auto relax_edges = [&](const vector<size_t>& frontier, bool is_light)
+	{
+		thread_pool.ParallelFor(0, frontier.size(),
+			[&](size_t thread_index, size_t chunk_begin, size_t chunk_end)
+			{
+				auto& local_updated_vertexes = thread_updated_vertexes[thread_index];
+
+				for (size_t i = chunk_begin; i < chunk_end; i++)
+				{
+					size_t current_vertex_index = frontier[i];
+					TE current_distance =
+						distances[current_vertex_index].load(std::memory_order_relaxed);
+
+					for (size_t j = out_offsets_[current_vertex_index];
+						j < out_offsets_[current_vertex_index + 1];
+						j++)
+					{
+						if ((out_costs_[j] <= delta) != is_light)
+						{
+							continue;
+						}
+
+						size_t adj_vertex_index = out_vertex_indexes_[j];
+						TE new_distance = current_distance + out_costs_[j];
+						TE old_distance =
+							distances[adj_vertex_index].load(std::memory_order_relaxed);
+
+						while (new_distance < old_distance)
+						{
+							if (distances[adj_vertex_index].compare_exchange_weak(
+								old_distance, new_distance, std::memory_order_relaxed))
+							{
+								local_updated_vertexes.push_back(adj_vertex_index);
+								break;
+							}
+						}
+					}
+				}
+			});
+
+		for (auto& i : thread_updated_vertexes)
+		{
+			for (auto j : i)
+			{
+				enqueue(j);
+			}
+
+			i.clear();
+		}
+	};
+
+	distances[source_vertex_index].store(0, std::memory_order_relaxed);
+	enqueue(source_vertex_index);
+
+	vector<size_t> frontier;
+	vector<size_t> settled_vertexes;
+
+	for (size_t i = 0; i < buckets.size(); i++)
+	{
+		settled_vertexes.clear();
+
+		while (!buckets[i].empty())
+		{
+			frontier.clear();
+
+			for (auto j : buckets[i])
+			{
+				if (queued_buckets[j] != i)
+				{
+					continue;
+				}
+
+				queued_buckets[j] = kNotQueued;
+				frontier.push_back(j);
+
+				if (settled_buckets[j] != i)
+				{
+					settled_buckets[j] = i;
+					settled_vertexes.push_back(j);
+				}
+			}
+
+			buckets[i].clear();
+
+			relax_edges(frontier, true);
+		}
+
+		relax_edges(settled_vertexes, false);
+	}
+
+	ShortestPathResults<TE> results(
+		vertex_count_, source_vertex_index, ShortestPathAlgorithm::DELTA_STEPPING);
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		results.distances[i] = distances[i].load(std::memory_order_relaxed);
+	}
+
+	BuildParents(results, thread_pool);
+
+	return results;
+}
+
+template<typename TE>
+void ShortestPaths<TE>::BuildParents(
+	ShortestPathResults<TE>& results, ThreadPool& thread_pool) const
+{
+	constexpr size_t kNoParent = ShortestPathResults<TE>::kNoParent;
+
+	const auto& distances = results.distances;
+
+	vector<atomic<size_t>> parents(vertex_count_);
+
+	for (auto& i : parents)
+	{
+		i.store(kNoParent, std::memory_order_relaxed);
+	}
+
+	thread_pool.ParallelFor(0, vertex_count_,
+		[&](size_t, size_t chunk_begin, size_t chunk_end)
+		{
+			for (size_t i = chunk_begin; i < chunk_end; i++)
+			{
+				if (!results.IsReachable(i))
+				{
+					continue;
+				}
+
+				for (size_t j = out_offsets_[i]; j < out_offsets_[i + 1]; j++)
+				{
+					size_t adj_vertex_index = out_vertex_indexes_[j];
+
+					if (distances[i] + out_costs_[j] != distances[adj_vertex_index]
+						|| !(distances[i] < distances[adj_vertex_index]))
+					{
+						continue;
+					}
+
+					size_t current_parent =
+						parents[adj_vertex_index].load(std::memory_order_relaxed);
+
+					while (i < current_parent
+						&& !parents[adj_vertex_index].compare_exchange_weak(
+							current_parent, i, std::memory_order_relaxed))
+					{
+					}
+				}
+			}
+		});
+
+	// ǷֻܾȨߵĶ㣬ʱڶ
+	bool has_orphan = false;
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		results.parents[i] = parents[i].load(std::memory_order_relaxed);
+
+		if (results.IsReachable(i)
+			&& results.parents[i] == kNoParent
+			&& i != results.source_vertex_index)
+		{
+			has_orphan = true;
+		}
+	}
+
+	if (!has_orphan)
+	{
+		return;
+	}
+
+	vector<size_t> zero_cost_frontier;
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		if (results.parents[i] != kNoParent || i == results.source_vertex_index)
+		{
+			zero_cost_frontier.push_back(i);
+		}
+	}
+
+	for (size_t i = 0; i < zero_cost_frontier.size(); i++)
+	{
+		size_t current_vertex_index = zero_cost_frontier[i];
+
+		for (size_t j = out_offsets_[current_vertex_index];
+			j < out_offsets_[current_vertex_index + 1];
+			j++)
+		{
+			size_t adj_vertex_index = out_vertex_indexes_[j];
+
+			if (out_costs_[j] == 0
+				&& distances[adj_vertex_index] == distances[current_vertex_index]
+				&& results.parents[adj_vertex_index] == kNoParent
+				&& adj_vertex_index != results.source_vertex_index)
+			{
+				results.parents[adj_vertex_index] = current_vertex_index;
+				zero_cost_frontier.push_back(adj_vertex_index);
+			}
+		}
+	}
+}
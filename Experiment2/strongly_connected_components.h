@@ -0,0 +1,673 @@
+#pragma once
+
+#include <iostream>
+#include <format>
+#include <vector>
+#include <atomic>
+#include <limits>
+#include <utility>
+
+#include "thread_pool.h"
+
+using std::cout;
+using std::endl;
+
+using std::format;
+
+using std::vector;
+using std::pair;
+using std::atomic;
+using std::numeric_limits;
+
+enum class SCCAlgorithm
+{
+	TARJAN,
+	KOSARAJU,
+	FORWARD_BACKWARD
+};
+
+// ǿͨ
+// ķŰС±˳0ʼţ
+// 㷨ͬһͼȫͬıš
+class StronglyConnectedComponentResults final
+{
+public:
+	SCCAlgorithm algorithm = SCCAlgorithm::TARJAN;
+	// ǿͨı
+	vector<size_t> component_labels;
+	size_t component_count = 0;
+
+	StronglyConnectedComponentResults() = default;
+	~StronglyConnectedComponentResults() = default;
+
+	// ̬ԱģDisplayStronglyConnectedComponentResults˳չʾǿͨ
+	// ͨgraph.GetVertexDataȡ
+	template<typename TGraph>
+	static void DisplayStronglyConnectedComponentResults(
+		const StronglyConnectedComponentResults& results,
+		const TGraph& graph)
+	{
+		const char* algorithm_name = "TARJAN";
+
+		if (results.algorithm == SCCAlgorithm::KOSARAJU)
+		{
+			algorithm_name = "KOSARAJU";
+		}
+		else if (results.algorithm == SCCAlgorithm::FORWARD_BACKWARD)
+		{
+			algorithm_name = "FORWARD-BACKWARD";
+		}
+
+		vector<vector<size_t>> components(results.component_count);
+
+		for (size_t i = 0; i < results.component_labels.size(); i++)
+		{
+			components[results.component_labels[i]].push_back(i);
+		}
+
+		cout << format("[STRONGLY CONNECTED COMPONENTS({0})]", algorithm_name) << endl;
+		cout << "NUMBER OF COMPONENT(s): " << results.component_count << endl;
+		cout << "COMPONENTS: ";
+
+		for (auto& i : components)
+		{
+			cout << "{ ";
+
+			for (auto j : i)
+			{
+				cout << format("([{0}]{1}) ", j, graph.GetVertexData(j));
+			}
+
+			cout << "} ";
+		}
+
+		cout << endl << endl;
+	}
+};
+
+// ǿͨ
+// ʱṩForEachAdjacentEdgeԱģͼиƳ洢ĳ߱
+// ɷͼԭͼ߱ͼÿϾڣõļΪͨ
+// 㷨ʹõݹ飬(±,һߵ±)Ϊ֡ʽջʵ֣
+// ں򶥵㡢·ͼ
+class StronglyConnectedComponents final
+{
+private:
+	static constexpr size_t kNoIndex = numeric_limits<size_t>::max();
+
+	// ǰسڴֵʱڵֱ߳չС߳ͬ
+	static constexpr size_t kParallelEdgeThreshold = 4096;
+
+	size_t vertex_count_ = 0;
+
+	vector<size_t> out_offsets_;
+	vector<size_t> out_vertex_indexes_;
+
+	// ͼĳ߱
+	vector<size_t> in_offsets_;
+	vector<size_t> in_vertex_indexes_;
+
+	// ԱMakeResults㷨Էĳһ±Ϊʱţ
+	// ˺ӳΪС±Ųɽ
+	StronglyConnectedComponentResults MakeResults(
+		vector<size_t>& labels, SCCAlgorithm algorithm) const;
+
+	// ԱTrim㲢еذʣͼжΪ0Ķ㣬ÿĶ㵥һǿͨ
+	// Ȱdegree_offsetsdegree_vertex_indexesʾıδڽӶ
+	// һʱһıʹڽӶĶȼһܿΪO( + )
+	void Trim(
+		const vector<size_t>& degree_offsets,
+		const vector<size_t>& degree_vertex_indexes,
+		const vector<size_t>& peel_offsets,
+		const vector<size_t>& peel_vertex_indexes,
+		vector<size_t>& labels,
+		vector<vector<size_t>>& thread_frontiers,
+		ThreadPool& thread_pool) const;
+
+	// ԱReachpivot_vertex_indexظı߽аͬĲй
+	// ֻɫͬĶ㣬Ķis_reachedλ
+	void Reach(
+		size_t pivot_vertex_index,
+		const vector<size_t>& offsets,
+		const vector<size_t>& vertex_indexes,
+		const vector<size_t>& colors,
+		vector<atomic<bool>>& is_reached,
+		vector<vector<size_t>>& thread_frontiers,
+		ThreadPool& thread_pool) const;
+
+public:
+	template<typename TGraph>
+	explicit StronglyConnectedComponents(const TGraph& graph);
+
+	~StronglyConnectedComponents() = default;
+
+	// ԱTarjanlow-linkֵʶĸO( + )
+	StronglyConnectedComponentResults Tarjan() const;
+
+	// ԱKosarajuԭͼ˳
+	// ٰ˳ڷͼÿĶ㹹һO( + )
+	StronglyConnectedComponentResults Kosaraju() const;
+
+	// ԱForwardBackward̵߳ǰ-㷨
+	// ȰȻΪ0Ķ㣬ٶʣÿȡһᶥ㣬
+	// ǰɴＯFɴＯBFBΪڵķ
+	// F\BB\Fඥ㻥ܴͬһֱΪµ⣨ɫ֣
+	StronglyConnectedComponentResults ForwardBackward(ThreadPool& thread_pool) const;
+};
+
+template<typename TGraph>
+StronglyConnectedComponents::StronglyConnectedComponents(const TGraph& graph) :
+	vertex_count_(graph.vertex_count)
+{
+	out_offsets_.assign(vertex_count_ + 1, 0);
+	in_offsets_.assign(vertex_count_ + 1, 0);
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		out_offsets_[i + 1] = out_offsets_[i];
+
+		graph.ForEachAdjacentEdge(i, [&](size_t adj_vertex_index, const auto&)
+			{
+				out_vertex_indexes_.push_back(adj_vertex_index);
+				out_offsets_[i + 1]++;
+				in_offsets_[adj_vertex_index + 1]++;
+			});
+	}
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		in_offsets_[i + 1] += in_offsets_[i];
+	}
+
+	in_vertex_indexes_.resize(out_vertex_indexes_.size());
+
+	vector<size_t> insert_positions(in_offsets_.begin(), in_offsets_.end() - 1);
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		for (size_t j = out_offsets_[i]; j < out_offsets_[i + 1]; j++)
+		{
+			in_vertex_indexes_[insert_positions[out_vertex_indexes_[j]]++] = i;
+		}
+	}
+}
+
+inline StronglyConnectedComponentResults StronglyConnectedComponents::MakeResults(
+	vector<size_t>& labels, SCCAlgorithm algorithm) const
+{
+	StronglyConnectedComponentResults results;
+	results.algorithm = algorithm;
+
+	vector<size_t> new_labels(vertex_count_, kNoIndex);
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		size_t& new_label = new_labels[labels[i]];
+
+		if (new_label == kNoIndex)
+		{
+			new_label = results.component_count++;
+		}
+
+		labels[i] = new_label;
+	}
+
+	results.component_labels = std::move(labels);
+
+	return results;
+}
+
+inline StronglyConnectedComponentResults StronglyConnectedComponents::Tarjan() const
+{
+	// ȱlow-linkֵǰΪkNoIndexʾδ
+	vector<size_t> dfs_numbers(vertex_count_, kNoIndex);
+	vector<size_t> low_links(vertex_count_);
+	vector<bool> is_on_stack(vertex_count_);
+	vector<size_t> labels(vertex_count_, kNoIndex);
+
+	// δѷʶ
+	vector<size_t> component_stack;
+	// ÿһ֡Ϊ(±,һߵ±)൱ڵݹ汾һõľֲ״̬
+	vector<pair<size_t, size_t>> dfs_stack;
+
+	size_t current_dfs_number = 0;
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		if (dfs_numbers[i] != kNoIndex)
+		{
+			continue;
+		}
+
+		dfs_numbers[i] = low_links[i] = current_dfs_number++;
+		component_stack.push_back(i);
+		is_on_stack[i] = true;
+		dfs_stack.emplace_back(i, out_offsets_[i]);
+
+		while (!dfs_stack.empty())
+		{
+			auto& [current_vertex_index, current_edge_index] = dfs_stack.back();
+
+			if (current_edge_index < out_offsets_[current_vertex_index + 1])
+			{
+				// ƽαջ֡ջʹջ֡ʧЧ
+				size_t adj_vertex_index = out_vertex_indexes_[current_edge_index++];
+
+				if (dfs_numbers[adj_vertex_index] == kNoIndex)
+				{
+					dfs_numbers[adj_vertex_index] = low_links[adj_vertex_index] =
+						current_dfs_number++;
+					component_stack.push_back(adj_vertex_index);
+					is_on_stack[adj_vertex_index] = true;
+					dfs_stack.emplace_back(adj_vertex_index, out_offsets_[adj_vertex_index]);
+				}
+				else if (is_on_stack[adj_vertex_index])
+				{
+					low_links[current_vertex_index] = std::min(
+						low_links[current_vertex_index], dfs_numbers[adj_vertex_index]);
+				}
+
+				continue;
+			}
+
+			size_t finished_vertex_index = current_vertex_index;
+			dfs_stack.pop_back();
+
+			// low-linkֵŵĶĸջ֮ϵĶһ
+			if (low_links[finished_vertex_index] == dfs_numbers[finished_vertex_index])
+			{
+				size_t component_vertex_index = kNoIndex;
+
+				do
+				{
+					component_vertex_index = component_stack.back();
+					component_stack.pop_back();
+					is_on_stack[component_vertex_index] = false;
+					labels[component_vertex_index] = finished_vertex_index;
+				} while (component_vertex_index != finished_vertex_index);
+			}
+
+			// ൱ڵݹ鷵غӶlow-linkֵ¸
+			if (!dfs_stack.empty())
+			{
+				size_t parent_vertex_index = dfs_stack.back().first;
+
+				low_links[parent_vertex_index] = std::min(
+					low_links[parent_vertex_index], low_links[finished_vertex_index]);
+			}
+		}
+	}
+
+	return MakeResults(labels, SCCAlgorithm::TARJAN);
+}
+
+inline StronglyConnectedComponentResults StronglyConnectedComponents::Kosaraju() const
+{
+	vector<bool> is_visited(vertex_count_);
+	vector<size_t> finish_order;
+	finish_order.reserve(vertex_count_);
+
+	vector<pair<size_t, size_t>> dfs_stack;
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		if (is_visited[i])
+		{
+			continue;
+		}
+
+		is_visited[i] = true;
+		dfs_stack.emplace_back(i, out_offsets_[i]);
+
+		while (!dfs_stack.empty())
+		{
+			auto& [current_vertex_index, current_edge_index] = dfs_stack.back();
+
+			if (current_edge_index == out_offsets_[current_vertex_index + 1])
+			{
+				finish_order.push_back(current_vertex_index);
+				dfs_stack.pop_back();
+				continue;
+			}
+
+			size_t adj_vertex_index = out_vertex_indexes_[current_edge_index++];
+
+			if (!is_visited[adj_vertex_index])
+			{
+				is_visited[adj_vertex_index] = true;
+				dfs_stack.emplace_back(adj_vertex_index, out_offsets_[adj_vertex_index]);
+			}
+		}
+	}
+
+	// ڶֻɴＯ˳޹ؽҪʹͨĶջ
+	vector<size_t> labels(vertex_count_, kNoIndex);
+	vector<size_t> search_stack;
+
+	for (auto i = finish_order.rbegin(); i != finish_order.rend(); i++)
+	{
+		size_t root_vertex_index = *i;
+
+		if (labels[root_vertex_index] != kNoIndex)
+		{
+			continue;
+		}
+
+		labels[root_vertex_index] = root_vertex_index;
+		search_stack.push_back(root_vertex_index);
+
+		while (!search_stack.empty())
+		{
+			size_t current_vertex_index = search_stack.back();
+			search_stack.pop_back();
+
+			for (size_t j = in_offsets_[current_vertex_index];
+				j < in_offsets_[current_vertex_index + 1];
+				j++)
+			{
+				size_t adj_vertex_index = in_vertex_indexes_[j];
+
+				if (labels[adj_vertex_index] == kNoIndex)
+				{
+					labels[adj_vertex_index] = root_vertex_index;
+					search_stack.push_back(adj_vertex_index);
+				}
+			}
+		}
+	}
+
+	return MakeResults(labels, SCCAlgorithm::KOSARAJU);
+}
+
+inline void StronglyConnectedComponents::Trim(
+	const vector<size_t>& degree_offsets,
+	const vector<size_t>& degree_vertex_indexes,
+	const vector<size_t>& peel_offsets,
+	const vector<size_t>& peel_vertex_indexes,
+	vector<size_t>& labels,
+	vector<vector<size_t>>& thread_frontiers,
+	ThreadPool& thread_pool) const
+{
+	const size_t thread_count = thread_pool.GetThreadCount();
+
+	vector<atomic<size_t>> degrees(vertex_count_);
+
+	thread_pool.ParallelFor(0, vertex_count_,
+		[&](size_t thread_index, size_t chunk_begin, size_t chunk_end)
+		{
+			for (size_t i = chunk_begin; i < chunk_end; i++)
+			{
+				if (labels[i] != kNoIndex)
+				{
+					continue;
+				}
+
+				size_t degree = 0;
+
+				for (size_t j = degree_offsets[i]; j < degree_offsets[i + 1]; j++)
+				{
+					if (labels[degree_vertex_indexes[j]] == kNoIndex)
+					{
+						degree++;
+					}
+				}
+
+				degrees[i].store(degree, std::memory_order_relaxed);
+
+				if (degree == 0)
+				{
+					thread_frontiers[thread_index].push_back(i);
+				}
+			}
+		});
+
+	vector<size_t> frontier;
+	vector<size_t> next_frontier;
+
+	// ڸֻ߳ȡlabelsĩͳһǱĶ
+	auto collect_frontier = [&](vector<size_t>& target_frontier)
+	{
+		target_frontier.clear();
+
+		for (size_t i = 0; i < thread_count; i++)
+		{
+			target_frontier.insert(target_frontier.end(),
+				thread_frontiers[i].begin(), thread_frontiers[i].end());
+			thread_frontiers[i].clear();
+		}
+
+		for (auto i : target_frontier)
+		{
+			labels[i] = i;
+		}
+	};
+
+	// ȼΪ0Ķǡñһ̹߳۲쵽ÿֻǰһ
+	auto peel = [&](size_t thread_index, size_t chunk_begin, size_t chunk_end)
+	{
+		auto& local_next_frontier = thread_frontiers[thread_index];
+
+		for (size_t i = chunk_begin; i < chunk_end; i++)
+		{
+			size_t current_vertex_index = frontier[i];
+
+			for (size_t j = peel_offsets[current_vertex_index];
+				j < peel_offsets[current_vertex_index + 1];
+				j++)
+			{
+				size_t adj_vertex_index = peel_vertex_indexes[j];
+
+				if (labels[adj_vertex_index] == kNoIndex
+					&& degrees[adj_vertex_index].fetch_sub(
+						1, std::memory_order_relaxed) == 1)
+				{
+					local_next_frontier.push_back(adj_vertex_index);
+				}
+			}
+		}
+	};
+
+	collect_frontier(frontier);
+
+	while (!frontier.empty())
+	{
+		size_t frontier_edge_count = 0;
+
+		for (auto i : frontier)
+		{
+			frontier_edge_count += peel_offsets[i + 1] - peel_offsets[i];
+		}
+
+		if (frontier_edge_count < kParallelEdgeThreshold || thread_count == 1)
+		{
+			peel(0, 0, frontier.size());
+		}
+		else
+		{
+			thread_pool.ParallelFor(0, frontier.size(), peel);
+		}
+
+		collect_frontier(next_frontier);
+
+		frontier.swap(next_frontier);
+	}
+}
+
+inline void StronglyConnectedComponents::Reach(
+	size_t pivot_vertex_index,
+	const vector<size_t>& offsets,
+	const vector<size_t>& vertex_indexes,
+	const vector<size_t>& colors,
+	vector<atomic<bool>>& is_reached,
+	vector<vector<size_t>>& thread_frontiers,
+	ThreadPool& thread_pool) const
+{
+	const size_t thread_count = thread_pool.GetThreadCount();
+	const size_t pivot_color = colors[pivot_vertex_index];
+
+	vector<size_t> frontier{ pivot_vertex_index };
+	vector<size_t> next_frontier;
+
+	is_reached[pivot_vertex_index].store(true, std::memory_order_relaxed);
+
+	auto expand = [&](size_t thread_index, size_t chunk_begin, size_t chunk_end)
+	{
+		auto& local_next_frontier = thread_frontiers[thread_index];
+
+		for (size_t i = chunk_begin; i < chunk_end; i++)
+		{
+			size_t current_vertex_index = frontier[i];
+
+			for (size_t j = offsets[current_vertex_index];
+				j < offsets[current_vertex_index + 1];
+				j++)
+			{
+				size_t adj_vertex_index = vertex_indexes[j];
+
+				if (colors[adj_vertex_index] != pivot_color
+					|| is_reached[adj_vertex_index].load(std::memory_order_relaxed))
+				{
+					continue;
+				}
+
+				if (!is_reached[adj_vertex_index].exchange(true, std::memory_order_relaxed))
+				{
+					local_next_frontier.push_back(adj_vertex_index);
+				}
+			}
+		}
+	};
+
+	while (!frontier.empty())
+	{
+		size_t frontier_edge_count = 0;
+
+		for (auto i : frontier)
+		{
+			frontier_edge_count += offsets[i + 1] - offsets[i];
+		}
+
+		if (frontier_edge_count < kParallelEdgeThreshold || thread_count == 1)
+		{
+			expand(0, 0, frontier.size());
+		}
+		else
+		{
+			thread_pool.ParallelFor(0, frontier.size(), expand);
+		}
+
+		next_frontier.clear();
+
+		for (size_t i = 0; i < thread_count; i++)
+		{
+			next_frontier.insert(next_frontier.end(),
+				thread_frontiers[i].begin(), thread_frontiers[i].end());
+			thread_frontiers[i].clear();
+		}
+
+		frontier.swap(next_frontier);
+	}
+}
+
+inline StronglyConnectedComponentResults StronglyConnectedComponents::ForwardBackward(
+	ThreadPool& thread_pool) const
+{
+	vector<size_t> labels(vertex_count_, kNoIndex);
+	vector<vector<size_t>> thread_frontiers(thread_pool.GetThreadCount());
+
+	// ȰΪ0Ķ㣬ٰΪ0Ķ㣻DAG״ڴȫ
+	Trim(in_offsets_, in_vertex_indexes_, out_offsets_, out_vertex_indexes_,
+		labels, thread_frontiers, thread_pool);
+	Trim(out_offsets_, out_vertex_indexes_, in_offsets_, in_vertex_indexes_,
+		labels, thread_frontiers, thread_pool);
+
+	// ɫѹĶΪkNoIndexᾭ
+	vector<size_t> colors(vertex_count_, kNoIndex);
+	vector<atomic<bool>> is_forward_reached(vertex_count_);
+	vector<atomic<bool>> is_backward_reached(vertex_count_);
+
+	// ⣬ÿĶ㰴±
+	vector<vector<size_t>> subproblems(1);
+
+	for (size_t i = 0; i < vertex_count_; i++)
+	{
+		is_forward_reached[i].store(false, std::memory_order_relaxed);
+		is_backward_reached[i].store(false, std::memory_order_relaxed);
+
+		if (labels[i] == kNoIndex)
+		{
+			colors[i] = 0;
+			subproblems[0].push_back(i);
+		}
+	}
+
+	size_t next_color = 1;
+
+	while (!subproblems.empty())
+	{
+		vector<size_t> current_vertexes = std::move(subproblems.back());
+		subproblems.pop_back();
+
+		if (current_vertexes.empty())
+		{
+			continue;
+		}
+
+		size_t pivot_vertex_index = current_vertexes.front();
+
+		Reach(pivot_vertex_index, out_offsets_, out_vertex_indexes_,
+			colors, is_forward_reached, thread_frontiers, thread_pool);
+		Reach(pivot_vertex_index, in_offsets_, in_vertex_indexes_,
+			colors, is_backward_reached, thread_frontiers, thread_pool);
+
+		// ΪF\BB\Fඥ
+		vector<size_t> forward_only_vertexes;
+		vector<size_t> backward_only_vertexes;
+		vector<size_t> remaining_vertexes;
+
+		for (auto i : current_vertexes)
+		{
+			bool is_forward = is_forward_reached[i].load(std::memory_order_relaxed);
+			bool is_backward = is_backward_reached[i].load(std::memory_order_relaxed);
+
+			is_forward_reached[i].store(false, std::memory_order_relaxed);
+			is_backward_reached[i].store(false, std::memory_order_relaxed);
+
+			if (is_forward && is_backward)
+			{
+				labels[i] = pivot_vertex_index;
+				colors[i] = kNoIndex;
+			}
+			else if (is_forward)
+			{
+				forward_only_vertexes.push_back(i);
+			}
+			else if (is_backward)
+			{
+				backward_only_vertexes.push_back(i);
+			}
+			else
+			{
+				remaining_vertexes.push_back(i);
+			}
+		}
+
+		for (auto* i : { &forward_only_vertexes, &backward_only_vertexes, &remaining_vertexes })
+		{
+			if (i->empty())
+			{
+				continue;
+			}
+
+			for (auto j : *i)
+			{
+				colors[j] = next_color;
+			}
+
+			next_color++;
+			subproblems.push_back(std::move(*i));
+		}
+	}
+
+	return MakeResults(labels, SCCAlgorithm::FORWARD_BACKWARD);
+}
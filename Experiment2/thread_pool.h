@@ -0,0 +1,167 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+
+using std::vector;
+using std::thread;
+using std::mutex;
+using std::unique_lock;
+using std::condition_variable;
+using std::function;
+
+// ̶С̳߳أͼ㷨ʹ
+// ߳гפÿRunֻ軽һζ´̣߳
+// ʺϰͬÿ㶼Ҫһ㷨
+// Ruṉ߳Ϊ0̲߳㡣
+class ThreadPool final
+{
+private:
+	vector<thread> workers_;
+	size_t thread_count_ = 1;
+
+	mutex mutex_;
+	condition_variable task_condition_;
+	condition_variable done_condition_;
+
+	const function<void(size_t)>* task_ = nullptr;
+	// ÿһһ߳̾ݴжǷ
+	size_t generation_ = 0;
+	size_t pending_count_ = 0;
+	bool is_stopping_ = false;
+
+	void WorkerLoop(size_t thread_index);
+
+public:
+	// thread_countΪ0ʱʹӲ
+	explicit ThreadPool(size_t thread_count = 0);
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	size_t GetThreadCount() const;
+
+	// ԱRunÿ߳Լ̱߳ŵһtaskȫɺ󷵻
+	void Run(const function<void(size_t)>& task);
+
+	// ԱģParallelFor[begin, end)ȷΪ߳䣬
+	// tt߳func(t, , յ)
+	// 仮ֻȡ߳˸̴߳ȷġ
+	template<typename TFunc>
+	void ParallelFor(size_t begin, size_t end, TFunc&& func);
+};
+
+inline ThreadPool::ThreadPool(size_t thread_count)
+{
+	if (thread_count == 0)
+	{
+		thread_count = std::max<size_t>(1, thread::hardware_concurrency());
+	}
+
+	thread_count_ = thread_count;
+
+	for (size_t i = 1; i < thread_count_; i++)
+	{
+		workers_.emplace_back(&ThreadPool::WorkerLoop, this, i);
+	}
+}
+
+inline ThreadPool::~ThreadPool()
+{
+	{
+		unique_lock<mutex> lock(mutex_);
+		is_stopping_ = true;
+	}
+
+	task_condition_.notify_all();
+
+	for (auto& i : workers_)
+	{
+		i.join();
+	}
+}
+
+inline size_t ThreadPool::GetThreadCount() const
+{
+	return thread_count_;
+}
+
+inline void ThreadPool::WorkerLoop(size_t thread_index)
+{
+	size_t finished_generation = 0;
+
+	while (true)
+	{
+		const function<void(size_t)>* current_task = nullptr;
+
+		{
+			unique_lock<mutex> lock(mutex_);
+			task_condition_.wait(lock, [&]
+				{
+					return is_stopping_ || generation_ != finished_generation;
+				});
+
+			if (is_stopping_)
+			{
+				return;
+			}
+
+			finished_generation = generation_;
+			current_task = task_;
+		}
+
+		(*current_task)(thread_index);
+
+		{
+			unique_lock<mutex> lock(mutex_);
+
+			if (--pending_count_ == 0)
+			{
+				done_condition_.notify_one();
+			}
+		}
+	}
+}
+
+inline void ThreadPool::Run(const function<void(size_t)>& task)
+{
+	if (thread_count_ == 1)
+	{
+		task(0);
+		return;
+	}
+
+	{
+		unique_lock<mutex> lock(mutex_);
+		task_ = &task;
+		pending_count_ = thread_count_ - 1;
+		generation_++;
+	}
+
+	task_condition_.notify_all();
+
+	task(0);
+
+	unique_lock<mutex> lock(mutex_);
+	done_condition_.wait(lock, [&] { return pending_count_ == 0; });
+	task_ = nullptr;
+}
+
+template<typename TFunc>
+void ThreadPool::ParallelFor(size_t begin, size_t end, TFunc&& func)
+{
+	const size_t total_count = end > begin ? end - begin : 0;
+
+	Run([&](size_t thread_index)
+		{
+			size_t chunk_begin = begin + total_count * thread_index / thread_count_;
+			size_t chunk_end = begin + total_count * (thread_index + 1) / thread_count_;
+
+			func(thread_index, chunk_begin, chunk_end);
+		});
+}
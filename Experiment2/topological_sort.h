@@ -0,0 +1,108 @@
+#pragma once
+
+#include <iostream>
+#include <format>
+#include <vector>
+
+using std::cout;
+using std::endl;
+
+using std::format;
+
+using std::vector;
+
+// 
+// orderΪУÿԪΪ±ꡣ
+// ͼлʱis_acyclicΪfalseorderֻڻҲܴӻĶ㡣
+class TopologicalOrderResults final
+{
+public:
+	vector<size_t> order;
+	bool is_acyclic = true;
+
+	TopologicalOrderResults() = default;
+	~TopologicalOrderResults() = default;
+
+	// ̬ԱģDisplayTopologicalOrderResultsչʾУ
+	// ͨgraph.GetVertexDataȡ
+	template<typename TGraph>
+	static void DisplayTopologicalOrderResults(
+		const TopologicalOrderResults& results,
+		const TGraph& graph)
+	{
+		cout << "[TOPOLOGICAL ORDER(KAHN)]" << endl;
+
+		if (!results.is_acyclic)
+		{
+			cout << "<GRAPH CONTAINS CYCLE(s), ONLY VERTEXES NOT REACHABLE FROM ANY CYCLE ARE ORDERED.>"
+				<< endl;
+		}
+
+		cout << "ORDER: ";
+
+		for (auto i : results.order)
+		{
+			cout << format("([{0}]{1}) ", i, graph.GetVertexData(i));
+		}
+
+		cout << endl << endl;
+	}
+};
+
+// 
+// ԱģṩForEachAdjacentEdgeԱģͼ󣬱߰ߴ
+// ͼֻҪڱ߾ͱȻл
+class TopologicalSorter final
+{
+public:
+	// ̬ԱģKahnKahn㷨Ϊ0Ķ㲢ɾȥߣO( + )
+	// Ϊ0ĶȽȳ˳ʼʱ±ӣȷġ
+	// ģУʹõݹ飬ռΪO()
+	template<typename TGraph>
+	static TopologicalOrderResults Kahn(const TGraph& graph);
+};
+
+template<typename TGraph>
+TopologicalOrderResults TopologicalSorter::Kahn(const TGraph& graph)
+{
+	const size_t vertex_count = graph.vertex_count;
+
+	vector<size_t> in_degrees(vertex_count);
+
+	for (size_t i = 0; i < vertex_count; i++)
+	{
+		graph.ForEachAdjacentEdge(i, [&](size_t adj_vertex_index, const auto&)
+			{
+				in_degrees[adj_vertex_index]++;
+			});
+	}
+
+	TopologicalOrderResults results;
+
+	// orderΪУ[0, front_position)ΪɾȥߵĶ
+	results.order.reserve(vertex_count);
+
+	for (size_t i = 0; i < vertex_count; i++)
+	{
+		if (in_degrees[i] == 0)
+		{
+			results.order.push_back(i);
+		}
+	}
+
+	for (size_t front_position = 0; front_position < results.order.size(); front_position++)
+	{
+		graph.ForEachAdjacentEdge(results.order[front_position],
+			[&](size_t adj_vertex_index, const auto&)
+			{
+				if (--in_degrees[adj_vertex_index] == 0)
+				{
+					results.order.push_back(adj_vertex_index);
+				}
+			});
+	}
+
+	results.is_acyclic = results.order.size() == vertex_count;
+
+	return results;
+}
@@ -1,48 +1,97 @@
 #pragma once
 
 #include <iostream>
+#include <format>
 #include <string>
 #include <vector>
+#include <tuple>
 
 using std::cout;
 using std::endl;
+using std::format;
 using std::string;
 using std::vector;
+using std::tuple;
+using std::get;
 
 enum class TraversalResultsType
 {
 	DFS_RECURSIVE,
 	DFS_ITERATIVE,
-	BFS
+	DFS_EXPLICIT_STACK,
+	BFS,
+	BFS_DIRECTION_OPTIMIZING,
+	BFS_PARALLEL,
+	BFS_REORDERED
+};
+
+// ӿ࣬ͼĸֱʵͨвĽ
+// ģTE: Ȩ
+// ʵֻ÷δ洢Ƿ洢о
+template<typename TE>
+class TraversalVisitor
+{
+public:
+	TraversalVisitor() = default;
+	virtual ~TraversalVisitor() = default;
+
+	// ԱOnVertexVisited㱻ʱãΪ±
+	virtual void OnVertexVisited(size_t vertex_index, int traversal_number) = 0;
+
+	// ԱOnSpanningTreeEdgeȷһʱ
+	virtual void OnSpanningTreeEdge(
+		size_t begin_vertex_index,
+		size_t end_vertex_index,
+		const TE& cost) = 0;
 };
 
 // ࣬Ȼȱ߼С
-// ģTV:
-template<typename TV>
-class TraversalResults final
+// ģTE: Ȩ; TV:
+// ±ʽ洢ֻչʾʱŸʽΪı
+template<typename TE, typename TV>
+class TraversalResults final :public TraversalVisitor<TE>
 {
 public:
 	TraversalResultsType results_type;
-	// ߼ÿԪض
-	// ([vertex_index1]vertex_data1-[vertex_index2]vertex_data2@cost)ʽ
-	vector<string> spanning_tree_edges;
-	// УÿԪض([vertex_index]vertex_data)ʽ
-	vector<string> traversal_list;
-	// 
-	vector<string> traversal_numbers;
-
-	// ʱ贫붥ԤΪŴ洢ռ
-	TraversalResults(size_t vertex_count,TraversalResultsType results_type):
+	// ߼ÿԪΪ(±,յ±,Ȩ)
+	vector<tuple<size_t, size_t, TE>> spanning_tree_edges;
+	// УÿԪΪ±
+	vector<size_t> traversal_list;
+	// ţδʵĶΪ-1
+	vector<int> traversal_numbers;
+
+	// ʱ贫붥ԤΪСŴ洢ÿռ
+	TraversalResults(size_t vertex_count, TraversalResultsType results_type) :
 		results_type(results_type)
 	{
-		traversal_numbers.resize(vertex_count);
+		traversal_numbers.resize(vertex_count, -1);
+		traversal_list.reserve(vertex_count);
+		spanning_tree_edges.reserve(vertex_count);
 	}
 
 	~TraversalResults() = default;
 
-	// ԱDisplayTraversalResultsչʾı
+	void OnVertexVisited(size_t vertex_index, int traversal_number) override
+	{
+		traversal_numbers[vertex_index] = traversal_number;
+		traversal_list.push_back(vertex_index);
+	}
+
+	void OnSpanningTreeEdge(
+		size_t begin_vertex_index,
+		size_t end_vertex_index,
+		const TE& cost) override
+	{
+		spanning_tree_edges.emplace_back(
+			begin_vertex_index, end_vertex_index, cost);
+	}
+
+	// ԱDisplayTraversalResultsչʾĽ
+	// graphͨGetVertexDataԱȡı
+	template<typename TGraph>
 	static void DisplayTraversalResults(
-		const TraversalResults<TV>& traversal_results)
+		const TraversalResults<TE, TV>& traversal_results,
+		const TGraph& graph)
 	{
 		string hint;
 
@@ -54,25 +103,40 @@ public:
 			case TraversalResultsType::DFS_ITERATIVE:
 				hint = "[DFS(ITERATIVE) RESULTS]";
 				break;
+			case TraversalResultsType::DFS_EXPLICIT_STACK:
+				hint = "[DFS(EXPLICIT STACK) RESULTS]";
+				break;
 			case TraversalResultsType::BFS:
 				hint = "[BFS RESULTS]";
 				break;
+			case TraversalResultsType::BFS_DIRECTION_OPTIMIZING:
+				hint = "[BFS(DIRECTION-OPTIMIZING) RESULTS]";
+				break;
+			case TraversalResultsType::BFS_PARALLEL:
+				hint = "[BFS(PARALLEL) RESULTS]";
+				break;
+			case TraversalResultsType::BFS_REORDERED:
+				hint = "[BFS(REORDERED) RESULTS]";
+				break;
 		}
 
 		cout << hint << endl;
 		cout << "TRAVERSAL LIST: ";
 
-		for (auto& i : traversal_results.traversal_list)
+		for (auto i : traversal_results.traversal_list)
 		{
-			cout << i << ' ';
+			cout << format("([{0}]{1}) ", i, graph.GetVertexData(i));
 		}
 
 		cout << endl;
 		cout << "TRAVERSAL NUMBERS: ";
 
-		for (auto& i : traversal_results.traversal_numbers)
+		for (size_t i = 0; i < traversal_results.traversal_numbers.size(); i++)
 		{
-			cout << i << ' ';
+			cout << format("([{0}]{1}:{2}) ",
+				i,
+				graph.GetVertexData(i),
+				traversal_results.traversal_numbers[i]);
 		}
 
 		cout << endl;
@@ -80,9 +144,14 @@ public:
 
 		for (auto& i : traversal_results.spanning_tree_edges)
 		{
-			cout << i << ' ';
+			cout << format("([{0}]{1}-[{2}]{3}@{4}) ",
+				get<0>(i),
+				graph.GetVertexData(get<0>(i)),
+				get<1>(i),
+				graph.GetVertexData(get<1>(i)),
+				get<2>(i));
 		}
 
 		cout << endl << endl;
 	}
-};
\ No newline at end of file
+};
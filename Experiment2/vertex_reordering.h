@@ -0,0 +1,528 @@
+#pragma once
+
+#include <iostream>
+#include <format>
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+
+#include "traversal_results.h"
+
+using std::cout;
+using std::endl;
+
+using std::format;
+
+using std::vector;
+using std::tuple;
+using std::pair;
+using std::make_tuple;
+using std::numeric_limits;
+
+enum class VertexOrdering
+{
+	// Cuthill-McKee򣺴αΧţͬڰʹԪڶԽ߸
+	REVERSE_CUTHILL_MCKEE,
+	// Ƚ򣺶ȴĶ㼯ǰƵʵУ
+	// ĿȵݵľֲԶǼСͨ
+	DEGREE_DESCENDING,
+	// 򣺰ȱķ˳ţBFSڴ˳һ
+	BFS
+};
+
+// ûVertexReordering::ComputePermutation
+// new_indexesoriginal_indexesΪûǰ±֮˫ת
+class VertexPermutation final
+{
+public:
+	VertexOrdering ordering = VertexOrdering::REVERSE_CUTHILL_MCKEE;
+	// new_indexes[ԭ±]Ϊöź±
+	vector<size_t> new_indexes;
+	// original_indexes[±]Ϊöǰ±
+	vector<size_t> original_indexes;
+
+	VertexPermutation() = default;
+	~VertexPermutation() = default;
+
+	// ̬ԱģDisplayVertexPermutation±˳չʾ㼰ԭ±꣬
+	// graphΪǰͼչʾǰڽӾĴ
+	template<typename TGraph>
+	static void DisplayVertexPermutation(
+		const VertexPermutation& permutation,
+		const TGraph& graph);
+};
+
+// ź±걨ıתΪԭ±תһ
+// Ų䣬źͼϱǰͼչʾɡ
+template<typename TE>
+class OriginalIndexVisitor final :public TraversalVisitor<TE>
+{
+private:
+	TraversalVisitor<TE>& visitor_;
+	const VertexPermutation& permutation_;
+
+public:
+	OriginalIndexVisitor(
+		TraversalVisitor<TE>& visitor,
+		const VertexPermutation& permutation) :
+		visitor_(visitor), permutation_(permutation)
+	{
+	}
+
+	~OriginalIndexVisitor() = default;
+
+	void OnVertexVisited(size_t vertex_index, int traversal_number) override
+	{
+		visitor_.OnVertexVisited(
+			permutation_.original_indexes[vertex_index], traversal_number);
+	}
+
+	void OnSpanningTreeEdge(
+		size_t begin_vertex_index,
+		size_t end_vertex_index,
+		const TE& cost) override
+	{
+		visitor_.OnSpanningTreeEdge(
+			permutation_.original_indexes[begin_vertex_index],
+			permutation_.original_indexes[end_vertex_index],
+			cost);
+	}
+};
+
+// 
+// ԱģṩForEachAdjacentEdgeԱģͼ
+// ֻȡڱ˵±֮ߵķ޹أͼҲԳƻڽӹϵߵĲ
+// ڽӹϵֻߵĶRCMBFS޷ǰš
+// źڽӱ߰±Уȡȱɨʵ±˴ģ
+// ǺϷȡȱͬһڽӶķȺǰͬ
+class VertexReordering final
+{
+private:
+	// ԱģGetAdjacencyArraysͼԳƻCSRʽ(ƫ,ڽӶ±)飬
+	// ÿڽӶΪһ˶ĲȥزȥԻĶȼΪڽӶ
+	template<typename TGraph>
+	static pair<vector<size_t>, vector<size_t>> GetAdjacencyArrays(const TGraph& graph);
+
+	// 㰴±еԭ±
+
+	static vector<size_t> ReverseCuthillMcKeeOrder(
+		const vector<size_t>& offsets,
+		const vector<size_t>& adj_vertex_indexes);
+
+	static vector<size_t> DegreeDescendingOrder(const vector<size_t>& offsets);
+
+	static vector<size_t> BFSOrder(
+		const vector<size_t>& offsets,
+		const vector<size_t>& adj_vertex_indexes);
+
+public:
+	// ̬ԱģComputePermutation˳󶥵û
+	template<typename TGraph>
+	static VertexPermutation ComputePermutation(const TGraph& graph, VertexOrdering ordering);
+
+	// ̬ԱģApplyûźĽͼ
+	// ʽAdjacencyListGraph::BuildGraphCSRGraph::BuildGraphĲͬ涥һͬƶ
+	template<template<typename, typename> class TGraph, typename TE, typename TV>
+	static auto Apply(const TGraph<TE, TV>& graph, const VertexPermutation& permutation)
+		->tuple<vector<TV>, vector<vector<pair<size_t, TE>>>, size_t>;
+
+	// ̬ԱģGetBandwidthڽӾĴ˶±֮ľֵֵ
+	// ԳƻڽӾĴͬ
+	// permutationź±
+	template<typename TGraph>
+	static size_t GetBandwidth(
+		const TGraph& graph,
+		const VertexPermutation* permutation = nullptr);
+};
+
+template<typename TGraph>
+void VertexPermutation::DisplayVertexPermutation(
+	const VertexPermutation& permutation,
+	const TGraph& graph)
+{
+	const char* ordering_name = "REVERSE CUTHILL-MCKEE";
+
+	if (permutation.ordering == VertexOrdering::DEGREE_DESCENDING)
+	{
+		ordering_name = "DEGREE DESCENDING";
+	}
+	else if (permutation.ordering == VertexOrdering::BFS)
+	{
+		ordering_name = "BFS";
+	}
+
+	cout << format("[VERTEX REORDERING({0})]", ordering_name) << endl;
+	cout << format("BANDWIDTH: {0} -> {1}",
+		VertexReordering::GetBandwidth(graph),
+		VertexReordering::GetBandwidth(graph, &permutation)) << endl;
+	cout << "NEW ORDER: ";
+
+	for (size_t i = 0; i < permutation.original_indexes.size(); i++)
+	{
+		size_t original_index = permutation.original_indexes[i];
+
+		cout << format("([{0}]{1}<-[{2}]) ",
+			i, graph.GetVertexData(original_index), original_index);
+	}
+
+	cout << endl << endl;
+}
+
+template<typename TGraph>
+pair<vector<size_t>, vector<size_t>> VertexReordering::GetAdjacencyArrays(const TGraph& graph)
+{
+	const size_t vertex_count = graph.vertex_count;
+
+	// һͳÿΪյĴÿ˸ռһλ
+	vector<size_t> offsets(vertex_count + 1, 0);
+
+	for (size_t i = 0; i < vertex_count; i++)
+	{
+		graph.ForEachAdjacentEdge(i, [&](size_t adj_vertex_index, const auto&)
+			{
+				if (adj_vertex_index != i)
+				{
+					offsets[i + 1]++;
+					offsets[adj_vertex_index + 1]++;
+				}
+			});
+	}
+
+	for (size_t i = 0; i < vertex_count; i++)
+	{
+		offsets[i + 1] += offsets[i];
+	}
+
+	// ڶڽӹϵ
+	vector<size_t> adj_vertex_indexes(offsets[vertex_count]);
+	vector<size_t> positions(offsets.begin(), offsets.end() - 1);
+
+	for (size_t i = 0; i < vertex_count; i++)
+	{
+		graph.ForEachAdjacentEdge(i, [&](size_t adj_vertex_index, const auto&)
+			{
+				if (adj_vertex_index != i)
+				{
+					adj_vertex_indexes[positions[i]++] = adj_vertex_index;
+					adj_vertex_indexes[positions[adj_vertex_index]++] = i;
+				}
+			});
+	}
+
+	// ͼÿߡͼеĻ߶Σȥغԭؽ
+	size_t compacted_size = 0;
+
+	for (size_t i = 0; i < vertex_count; i++)
+	{
+		auto row_begin = adj_vertex_indexes.begin() + offsets[i];
+		auto row_end = adj_vertex_indexes.begin() + offsets[i + 1];
+
+		std::sort(row_begin, row_end);
+		row_end = std::unique(row_begin, row_end);
+
+		offsets[i] = compacted_size;
+		compacted_size = std::copy(row_begin, row_end,
+			adj_vertex_indexes.begin() + compacted_size) - adj_vertex_indexes.begin();
+	}
+
+	offsets[vertex_count] = compacted_size;
+	adj_vertex_indexes.resize(compacted_size);
+
+	return { std::move(offsets), std::move(adj_vertex_indexes) };
+}
+
+inline vector<size_t> VertexReordering::ReverseCuthillMcKeeOrder(
+	const vector<size_t>& offsets,
+	const vector<size_t>& adj_vertex_indexes)
+{
+	const size_t vertex_count = offsets.size() - 1;
+
+	auto get_degree = [&](size_t vertex_index)
+	{
+		return offsets[vertex_index + 1] - offsets[vertex_index];
+	};
+
+	auto is_lower_degree = [&](size_t first_vertex_index, size_t second_vertex_index)
+	{
+		return get_degree(first_vertex_index) != get_degree(second_vertex_index) ?
+			get_degree(first_vertex_index) < get_degree(second_vertex_index) :
+			first_vertex_index < second_vertex_index;
+	};
+
+	vector<size_t> order;
+	order.reserve(vertex_count);
+
+	vector<bool> is_numbered(vertex_count);
+
+	// ѰαΧʱʹõķʱǣִαָ
+	vector<size_t> search_marks(vertex_count, numeric_limits<size_t>::max());
+	size_t search_round = 0;
+
+	vector<size_t> level;
+	vector<size_t> next_level;
+
+	// rootδŵĶа(,һжСĶ)
+	auto get_last_level = [&](size_t root_vertex_index) -> pair<size_t, size_t>
+	{
+		search_round++;
+		search_marks[root_vertex_index] = search_round;
+
+		level.assign(1, root_vertex_index);
+
+		size_t level_count = 0;
+		size_t last_level_vertex_index = root_vertex_index;
+
+		while (!level.empty())
+		{
+			level_count++;
+			last_level_vertex_index = *std::min_element(
+				level.begin(), level.end(), is_lower_degree);
+
+			next_level.clear();
+
+			for (auto i : level)
+			{
+				for (size_t j = offsets[i]; j < offsets[i + 1]; j++)
+				{
+					size_t adj_vertex_index = adj_vertex_indexes[j];
+
+					if (!is_numbered[adj_vertex_index]
+						&& search_marks[adj_vertex_index] != search_round)
+					{
+						search_marks[adj_vertex_index] = search_round;
+						next_level.push_back(adj_vertex_index);
+					}
+				}
+			}
+
+			level.swap(next_level);
+		}
+
+		return { level_count, last_level_vertex_index };
+	};
+
+	// еĺѡ㣬ÿͨеһδŵĶ㿪ʼ
+	vector<size_t> candidates(vertex_count);
+	std::iota(candidates.begin(), candidates.end(), 0);
+	std::sort(candidates.begin(), candidates.end(), is_lower_degree);
+
+	vector<size_t> adj_buffer;
+
+	for (auto i : candidates)
+	{
+		if (is_numbered[i])
+		{
+			continue;
+		}
+
+		// George-Liu㷨ƵһжСĶ㣬ֱӣõαΧ
+		size_t root_vertex_index = i;
+		auto [level_count, last_level_vertex_index] = get_last_level(root_vertex_index);
+
+		while (true)
+		{
+			auto [next_level_count, next_last_level_vertex_index] =
+				get_last_level(last_level_vertex_index);
+
+			if (next_level_count <= level_count)
+			{
+				break;
+			}
+
+			root_vertex_index = last_level_vertex_index;
+			level_count = next_level_count;
+			last_level_vertex_index = next_last_level_vertex_index;
+		}
+
+		// Cuthill-McKeeţorderΪУͬһδڽӶ㰴
+		size_t front_position = order.size();
+
+		is_numbered[root_vertex_index] = true;
+		order.push_back(root_vertex_index);
+
+		for (; front_position < order.size(); front_position++)
+		{
+			size_t current_vertex_index = order[front_position];
+
+			adj_buffer.clear();
+
+			for (size_t j = offsets[current_vertex_index];
+				j < offsets[current_vertex_index + 1];
+				j++)
+			{
+				size_t adj_vertex_index = adj_vertex_indexes[j];
+
+				if (!is_numbered[adj_vertex_index])
+				{
+					is_numbered[adj_vertex_index] = true;
+					adj_buffer.push_back(adj_vertex_index);
+				}
+			}
+
+			std::sort(adj_buffer.begin(), adj_buffer.end(), is_lower_degree);
+			order.insert(order.end(), adj_buffer.begin(), adj_buffer.end());
+		}
+	}
+
+	std::reverse(order.begin(), order.end());
+
+	return order;
+}
+
+inline vector<size_t> VertexReordering::DegreeDescendingOrder(const vector<size_t>& offsets)
+{
+	const size_t vertex_count = offsets.size() - 1;
+
+	vector<size_t> order(vertex_count);
+	std::iota(order.begin(), order.end(), 0);
+
+	// ͬĶ㱣ԭеȺ˳
+	std::stable_sort(order.begin(), order.end(),
+		[&](size_t first_vertex_index, size_t second_vertex_index)
+		{
+			return offsets[first_vertex_index + 1] - offsets[first_vertex_index]
+				> offsets[second_vertex_index + 1] - offsets[second_vertex_index];
+		});
+
+	return order;
+}
+
+inline vector<size_t> VertexReordering::BFSOrder(
+	const vector<size_t>& offsets,
+	const vector<size_t>& adj_vertex_indexes)
+{
+	const size_t vertex_count = offsets.size() - 1;
+
+	vector<size_t> order;
+	order.reserve(vertex_count);
+
+	vector<bool> is_visited(vertex_count);
+
+	// ͼBFSͬ±˳ÿδʶ㿪ʼorderΪ
+	for (size_t i = 0; i < vertex_count; i++)
+	{
+		if (is_visited[i])
+		{
+			continue;
+		}
+
+		is_visited[i] = true;
+		order.push_back(i);
+
+		for (size_t front_position = order.size() - 1;
+			front_position < order.size();
+			front_position++)
+		{
+			size_t current_vertex_index = order[front_position];
+
+			for (size_t j = offsets[current_vertex_index];
+				j < offsets[current_vertex_index + 1];
+				j++)
+			{
+				size_t adj_vertex_index = adj_vertex_indexes[j];
+
+				if (!is_visited[adj_vertex_index])
+				{
+					is_visited[adj_vertex_index] = true;
+					order.push_back(adj_vertex_index);
+				}
+			}
+		}
+	}
+
+	return order;
+}
+
+template<typename TGraph>
+VertexPermutation VertexReordering::ComputePermutation(
+	const TGraph& graph, VertexOrdering ordering)
+{
+	auto [offsets, adj_vertex_indexes] = GetAdjacencyArrays(graph);
+
+	VertexPermutation permutation;
+	permutation.ordering = ordering;
+
+	switch (ordering)
+	{
+		case VertexOrdering::REVERSE_CUTHILL_MCKEE:
+			permutation.original_indexes =
+				ReverseCuthillMcKeeOrder(offsets, adj_vertex_indexes);
+			break;
+		case VertexOrdering::DEGREE_DESCENDING:
+			permutation.original_indexes = DegreeDescendingOrder(offsets);
+			break;
+		case VertexOrdering::BFS:
+			permutation.original_indexes = BFSOrder(offsets, adj_vertex_indexes);
+			break;
+	}
+
+	permutation.new_indexes.resize(graph.vertex_count);
+
+	for (size_t i = 0; i < graph.vertex_count; i++)
+	{
+		permutation.new_indexes[permutation.original_indexes[i]] = i;
+	}
+
+	return permutation;
+}
+
+template<template<typename, typename> class TGraph, typename TE, typename TV>
+auto VertexReordering::Apply(
+	const TGraph<TE, TV>& graph, const VertexPermutation& permutation)
+	->tuple<vector<TV>, vector<vector<pair<size_t, TE>>>, size_t>
+{
+	vector<TV> vex_data;
+	vector<vector<pair<size_t, TE>>> vex_adj_data(graph.vertex_count);
+
+	vex_data.reserve(graph.vertex_count);
+
+	// ±˳ɸ㣬ڽӱ˳д
+	for (size_t i = 0; i < graph.vertex_count; i++)
+	{
+		size_t original_index = permutation.original_indexes[i];
+
+		vex_data.push_back(graph.GetVertexData(original_index));
+
+		auto& current_vex_adj_data = vex_adj_data[i];
+
+		graph.ForEachAdjacentEdge(original_index, [&](size_t adj_vertex_index, const TE& cost)
+			{
+				current_vex_adj_data.emplace_back(permutation.new_indexes[adj_vertex_index], cost);
+			});
+
+		std::sort(current_vex_adj_data.begin(), current_vex_adj_data.end(),
+			[](const pair<size_t, TE>& first_edge, const pair<size_t, TE>& second_edge)
+			{
+				return first_edge.first < second_edge.first;
+			});
+	}
+
+	return make_tuple(std::move(vex_data), std::move(vex_adj_data), graph.edge_count);
+}
+
+template<typename TGraph>
+size_t VertexReordering::GetBandwidth(
+	const TGraph& graph,
+	const VertexPermutation* permutation)
+{
+	size_t bandwidth = 0;
+
+	for (size_t i = 0; i < graph.vertex_count; i++)
+	{
+		size_t begin_vertex_index = permutation ? permutation->new_indexes[i] : i;
+
+		graph.ForEachAdjacentEdge(i, [&](size_t adj_vertex_index, const auto&)
+			{
+				size_t end_vertex_index =
+					permutation ? permutation->new_indexes[adj_vertex_index] : adj_vertex_index;
+
+				bandwidth = std::max(bandwidth, begin_vertex_index > end_vertex_index ?
+					begin_vertex_index - end_vertex_index : end_vertex_index - begin_vertex_index);
+			});
+	}
+
+	return bandwidth;
+}
@@ -1,10 +1,21 @@
 ﻿#include <iostream>
 #include "search_presenter.h"
+#include "../Common/instrumentation.h"
+
+using std::cout;
+using std::endl;
 
 int main()
 {
     SearchPresenter<> search_presenter;
     search_presenter.BeginPresentation();
 
+    // 启用插桩（定义DSE_INSTRUMENTATION）时，以JSON形式输出各热点操作的计数器
+#ifdef DSE_INSTRUMENTATION
+    cout << "[INSTRUMENTATION]" << endl;
+    Instrumentation::DumpJson(cout);
+    cout << endl;
+#endif
+
     return 0;
 }
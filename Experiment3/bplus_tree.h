@@ -0,0 +1,512 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "../Common/instrumentation.h"
+
+using std::array;
+using std::numeric_limits;
+using std::pair;
+using std::vector;
+
+// B+BinarySearchTreeṩͬInsert/Search/Delete/GetSortedListӿڡ
+// ģkNodeBytesÿռõֽĬ256ֽڼ4У㰴ж롣
+// ؼֻҶУҶ㰴ؼ˳ӣForEachInRange˳ɨ裻
+// ڲkeys[i]Ϊchildren[i + 1]еСؼ֡
+// vectorУ±໥ãڴ档
+// һβֻ߸㣬ÿڵĹؼţԼķʽȽϣ
+// ʱAVX2MSVC/arch:AVX2GCC/Clang-mavx2TΪintʱÿαȽ8ؼ֣
+// ʹñѭɱԶ
+template<typename T, size_t kNodeBytes = 256>
+class BPlusTree final
+{
+private:
+	using NodeIndex = uint32_t;
+
+	static constexpr NodeIndex kNullNode = numeric_limits<NodeIndex>::max();
+	static constexpr size_t kCacheLineSize = 64;
+
+	// ҶؼŹؼָһҶ±
+	static constexpr size_t kLeafCapacity =
+		(kNodeBytes - 2 * sizeof(NodeIndex)) / sizeof(T);
+	// ڲĺӱȹؼֶһŹؼָ
+	static constexpr size_t kInnerCapacity =
+		(kNodeBytes - 2 * sizeof(NodeIndex)) / (sizeof(T) + sizeof(NodeIndex));
+
+	static_assert(kLeafCapacity >= 2 && kInnerCapacity >= 2,
+		"kNodeBytes is too small for the key type.");
+
+	// Ѻÿڲһӣ߲±λ
+	static constexpr size_t kMaxHeight = numeric_limits<NodeIndex>::digits;
+
+	struct alignas(kCacheLineSize) LeafNode
+	{
+		T keys[kLeafCapacity];
+		NodeIndex key_count = 0;
+		NodeIndex next_leaf = kNullNode;
+	};
+
+	struct alignas(kCacheLineSize) InnerNode
+	{
+		T keys[kInnerCapacity];
+		NodeIndex children[kInnerCapacity + 1];
+		NodeIndex key_count = 0;
+	};
+
+	vector<LeafNode> leaf_nodes_;
+	vector<InnerNode> inner_nodes_;
+
+	NodeIndex root_ = kNullNode;
+	// ߣֻһҶʱΪ1Ϊ0height_Ϊ1ʱΪҶ㣬Ϊڲ
+	size_t height_ = 0;
+
+	// ̬ԱģCountKeysBelowkeys[0, key_count)СvalueĹؼָ
+	// kIncludeEqualΪtrueʱزvalueĹؼָ
+	template<bool kIncludeEqual>
+	static size_t CountKeysBelow(const T* keys, size_t key_count, const T& value);
+
+	// ԸеvalueڵҶ㣬Ҷ±꣬ұȽϴۼӵcompare_count
+	NodeIndex FindLeaf(const T& value, size_t& compare_count) const;
+
+	NodeIndex AllocateLeaf();
+	NodeIndex AllocateInner();
+
+public:
+	BPlusTree() = default;
+	~BPlusTree() = default;
+
+	// B+
+	void Clear();
+	// ԪأѴʱִκβ
+	void Insert(const T& value);
+	// Ԫأ{ָҶиԪصָ루ʱΪգ,ұȽϴ}
+	// Ƚϴ·ÿڲȽϵȫؼ
+	pair<const T*, size_t> Search(const T& value) const;
+	// ɾԪءɾ󲻺ϲ㣬ҶΪգȻȷ
+	void Delete(const T& value);
+	// еУҶõ
+	vector<T> GetSortedList() const;
+	// [low, high]ڵÿԪصfunc(value)λlowҶҶɨ
+	template<typename TFunc>
+	void ForEachInRange(const T& low, const T& high, TFunc&& func) const;
+	// ߣһβҷʵĽ
+	size_t GetHeight() const;
+};
+
+template<typename T, size_t kNodeBytes>
+template<bool kIncludeEqual>
+size_t BPlusTree<T, kNodeBytes>::CountKeysBelow(
+	const T* keys, size_t key_count, const T& value)
+{
+	size_t count = 0;
+	size_t i = 0;
+
+#ifdef __AVX2__
+	if constexpr (std::is_same_v<T, int>)
+	{
+		const __m256i value_vector = _mm256_set1_epi32(value);
+
+		for (; i + 8 <= key_count; i += 8)
+		{
+			__m256i key_vector =
+				_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+
+			if constexpr (kIncludeEqual)
+			{
+				// valueĸ = 8 - valueĸ
+				count += 8 - std::popcount(static_cast<unsigned>(_mm256_movemask_ps(
+					_mm256_castsi256_ps(_mm256_cmpgt_epi32(key_vector, value_vector)))));
+			}
+			else
+			{
+				count += std::popcount(static_cast<unsigned>(_mm256_movemask_ps(
+					_mm256_castsi256_ps(_mm256_cmpgt_epi32(value_vector, key_vector)))));
+			}
+		}
+	}
+#endif
+
+	// ؼĹؼָΪλã֧
+	for (; i < key_count; i++)
+	{
+		if constexpr (kIncludeEqual)
+		{
+			count += !(value < keys[i]);
+		}
+		else
+		{
+			count += keys[i] < value;
+		}
+	}
+
+	return count;
+}
+
+template<typename T, size_t kNodeBytes>
+auto BPlusTree<T, kNodeBytes>::FindLeaf(const T& value, size_t& compare_count) const
+	->NodeIndex
+{
+	NodeIndex current_node = root_;
+
+	for (size_t level = 1; level < height_; level++)
+	{
+		const InnerNode& inner_node = inner_nodes_[current_node];
+
+		compare_count += inner_node.key_count;
+		current_node = inner_node.children[
+			CountKeysBelow<true>(inner_node.keys, inner_node.key_count, value)];
+	}
+
+	return current_node;
+}
+
+template<typename T, size_t kNodeBytes>
+auto BPlusTree<T, kNodeBytes>::AllocateLeaf()->NodeIndex
+{
+	// ֻڲʱ䣬Insertļ
+	DSE_INSTRUMENT_COUNTERS("BPlusTree::Insert");
+
+	leaf_nodes_.emplace_back();
+	DSE_INSTRUMENT_ADD(ALLOCATIONS, 1);
+	return static_cast<NodeIndex>(leaf_nodes_.size() - 1);
+}
+
+template<typename T, size_t kNodeBytes>
+auto BPlusTree<T, kNodeBytes>::AllocateInner()->NodeIndex
+{
+	// ֻڲʱ䣬Insertļ
+	DSE_INSTRUMENT_COUNTERS("BPlusTree::Insert");
+
+	inner_nodes_.emplace_back();
+	DSE_INSTRUMENT_ADD(ALLOCATIONS, 1);
+	return static_cast<NodeIndex>(inner_nodes_.size() - 1);
+}
+
+template<typename T, size_t kNodeBytes>
+void BPlusTree<T, kNodeBytes>::Clear()
+{
+	leaf_nodes_.clear();
+	inner_nodes_.clear();
+	root_ = kNullNode;
+	height_ = 0;
+}
+
+template<typename T, size_t kNodeBytes>
+void BPlusTree<T, kNodeBytes>::Insert(const T& value)
+{
+	DSE_INSTRUMENT_SCOPE("BPlusTree::Insert");
+
+	if (height_ == 0)
+	{
+		root_ = AllocateLeaf();
+		height_ = 1;
+	}
+
+	// ¼·ϵڲ㼰뺢ӵλãʱϲ
+	array<NodeIndex, kMaxHeight> path_nodes;
+	array<size_t, kMaxHeight> path_child_positions;
+	// λλҲʱ簴룩ʱ㱣ȫǸһ
+	bool is_rightmost = true;
+
+	NodeIndex current_node = root_;
+
+	for (size_t level = 0; level + 1 < height_; level++)
+	{
+		const InnerNode& inner_node = inner_nodes_[current_node];
+		size_t child_position =
+			CountKeysBelow<true>(inner_node.keys, inner_node.key_count, value);
+
+		path_nodes[level] = current_node;
+		path_child_positions[level] = child_position;
+		is_rightmost = is_rightmost && child_position == inner_node.key_count;
+
+		current_node = inner_node.children[child_position];
+	}
+
+	size_t position;
+
+	{
+		LeafNode& leaf_node = leaf_nodes_[current_node];
+		position = CountKeysBelow<false>(leaf_node.keys, leaf_node.key_count, value);
+
+		if (position < leaf_node.key_count && leaf_node.keys[position] == value)
+		{
+			return;
+		}
+
+		if (leaf_node.key_count < kLeafCapacity)
+		{
+			for (size_t i = leaf_node.key_count; i > position; i--)
+			{
+				leaf_node.keys[i] = std::move(leaf_node.keys[i - 1]);
+			}
+
+			leaf_node.keys[position] = value;
+			leaf_node.key_count++;
+			return;
+		}
+	}
+
+	// ҶΪҶ㣬ҶСؼΪָؼֲ븸
+	NodeIndex new_leaf_index = AllocateLeaf();
+
+	{
+		// ʹvector·ڴ棬ڷ֮ȡ
+		LeafNode& leaf_node = leaf_nodes_[current_node];
+		LeafNode& new_leaf_node = leaf_nodes_[new_leaf_index];
+
+		array<T, kLeafCapacity + 1> merged_keys;
+
+		for (size_t i = 0, j = 0; i <= kLeafCapacity; i++)
+		{
+			merged_keys[i] = i == position ? value : std::move(leaf_node.keys[j++]);
+		}
+
+		size_t left_count = is_rightmost && position == kLeafCapacity
+			? kLeafCapacity
+			: (kLeafCapacity + 1) / 2;
+
+		for (size_t i = 0; i < left_count; i++)
+		{
+			leaf_node.keys[i] = std::move(merged_keys[i]);
+		}
+
+		for (size_t i = left_count; i <= kLeafCapacity; i++)
+		{
+			new_leaf_node.keys[i - left_count] = std::move(merged_keys[i]);
+		}
+
+		leaf_node.key_count = static_cast<NodeIndex>(left_count);
+		new_leaf_node.key_count = static_cast<NodeIndex>(kLeafCapacity + 1 - left_count);
+
+		new_leaf_node.next_leaf = leaf_node.next_leaf;
+		leaf_node.next_leaf = new_leaf_index;
+	}
+
+	T separator = leaf_nodes_[new_leaf_index].keys[0];
+	NodeIndex new_child = new_leaf_index;
+
+	// Եϲָؼ֣ʱ
+	for (size_t level = height_ - 1; level-- > 0;)
+	{
+		NodeIndex inner_index = path_nodes[level];
+		size_t child_position = path_child_positions[level];
+
+		{
+			InnerNode& inner_node = inner_nodes_[inner_index];
+
+			if (inner_node.key_count < kInnerCapacity)
+			{
+				for (size_t i = inner_node.key_count; i > child_position; i--)
+				{
+					inner_node.keys[i] = std::move(inner_node.keys[i - 1]);
+					inner_node.children[i + 1] = inner_node.children[i];
+				}
+
+				inner_node.keys[child_position] = std::move(separator);
+				inner_node.children[child_position + 1] = new_child;
+				inner_node.key_count++;
+				return;
+			}
+		}
+
+		NodeIndex new_inner_index = AllocateInner();
+
+		InnerNode& inner_node = inner_nodes_[inner_index];
+		InnerNode& new_inner_node = inner_nodes_[new_inner_index];
+
+		array<T, kInnerCapacity + 1> merged_keys;
+		array<NodeIndex, kInnerCapacity + 2> merged_children;
+
+		merged_children[0] = inner_node.children[0];
+
+		for (size_t i = 0, j = 0; i <= kInnerCapacity; i++)
+		{
+			if (i == child_position)
+			{
+				merged_keys[i] = std::move(separator);
+				merged_children[i + 1] = new_child;
+			}
+			else
+			{
+				merged_keys[i] = std::move(inner_node.keys[j]);
+				merged_children[i + 1] = inner_node.children[j + 1];
+				j++;
+			}
+		}
+
+		// ౣleft_countؼ֣merged_keys[left_count]㣬½
+		size_t left_count = is_rightmost && child_position == kInnerCapacity
+			? kInnerCapacity
+			: (kInnerCapacity + 1) / 2;
+
+		for (size_t i = 0; i < left_count; i++)
+		{
+			inner_node.keys[i] = std::move(merged_keys[i]);
+			inner_node.children[i + 1] = merged_children[i + 1];
+		}
+
+		new_inner_node.children[0] = merged_children[left_count + 1];
+
+		for (size_t i = left_count + 1; i <= kInnerCapacity; i++)
+		{
+			new_inner_node.keys[i - left_count - 1] = std::move(merged_keys[i]);
+			new_inner_node.children[i - left_count] = merged_children[i + 1];
+		}
+
+		inner_node.key_count = static_cast<NodeIndex>(left_count);
+		new_inner_node.key_count = static_cast<NodeIndex>(kInnerCapacity - left_count);
+
+		separator = std::move(merged_keys[left_count]);
+		new_child = new_inner_index;
+	}
+
+	// ѣ߼һ
+	NodeIndex new_root_index = AllocateInner();
+	InnerNode& new_root = inner_nodes_[new_root_index];
+
+	new_root.keys[0] = std::move(separator);
+	new_root.children[0] = root_;
+	new_root.children[1] = new_child;
+	new_root.key_count = 1;
+
+	root_ = new_root_index;
+	height_++;
+}
+
+template<typename T, size_t kNodeBytes>
+pair<const T*, size_t> BPlusTree<T, kNodeBytes>::Search(const T& value) const
+{
+	DSE_INSTRUMENT_SCOPE("BPlusTree::Search");
+
+	if (height_ == 0)
+	{
+		return { nullptr,0 };
+	}
+
+	size_t compare_count = 0;
+	const LeafNode& leaf_node = leaf_nodes_[FindLeaf(value, compare_count)];
+
+	compare_count += leaf_node.key_count;
+	size_t position = CountKeysBelow<false>(leaf_node.keys, leaf_node.key_count, value);
+
+	const T* search_result = nullptr;
+
+	if (position < leaf_node.key_count)
+	{
+		compare_count++;
+
+		if (leaf_node.keys[position] == value)
+		{
+			search_result = &leaf_node.keys[position];
+		}
+	}
+
+	DSE_INSTRUMENT_ADD(COMPARES, compare_count);
+	DSE_INSTRUMENT_ADD(NODES_VISITED, height_);
+	DSE_INSTRUMENT_PEAK(PEAK_DEPTH, height_);
+
+	return { search_result,compare_count };
+}
+
+template<typename T, size_t kNodeBytes>
+void BPlusTree<T, kNodeBytes>::Delete(const T& value)
+{
+	if (height_ == 0)
+	{
+		return;
+	}
+
+	size_t compare_count = 0;
+	LeafNode& leaf_node = leaf_nodes_[FindLeaf(value, compare_count)];
+
+	size_t position = CountKeysBelow<false>(leaf_node.keys, leaf_node.key_count, value);
+
+	if (position < leaf_node.key_count && leaf_node.keys[position] == value)
+	{
+		for (size_t i = position + 1; i < leaf_node.key_count; i++)
+		{
+			leaf_node.keys[i - 1] = std::move(leaf_node.keys[i]);
+		}
+
+		leaf_node.key_count--;
+	}
+}
+
+template<typename T, size_t kNodeBytes>
+vector<T> BPlusTree<T, kNodeBytes>::GetSortedList() const
+{
+	vector<T> sorted_list;
+
+	if (height_ == 0)
+	{
+		return sorted_list;
+	}
+
+	// Ҷ㼴һҶ㣬ֻҲҶ
+	for (NodeIndex current_leaf = 0;
+		current_leaf != kNullNode;
+		current_leaf = leaf_nodes_[current_leaf].next_leaf)
+	{
+		const LeafNode& leaf_node = leaf_nodes_[current_leaf];
+		sorted_list.insert(sorted_list.end(),
+			leaf_node.keys, leaf_node.keys + leaf_node.key_count);
+	}
+
+	return sorted_list;
+}
+
+template<typename T, size_t kNodeBytes>
+template<typename TFunc>
+void BPlusTree<T, kNodeBytes>::ForEachInRange(
+	const T& low, const T& high, TFunc&& func) const
+{
+	if (height_ == 0)
+	{
+		return;
+	}
+
+	size_t compare_count = 0;
+	NodeIndex current_leaf = FindLeaf(low, compare_count);
+
+	const LeafNode* leaf_node = &leaf_nodes_[current_leaf];
+	size_t position = CountKeysBelow<false>(leaf_node->keys, leaf_node->key_count, low);
+
+	while (true)
+	{
+		for (; position < leaf_node->key_count; position++)
+		{
+			if (high < leaf_node->keys[position])
+			{
+				return;
+			}
+
+			func(leaf_node->keys[position]);
+		}
+
+		current_leaf = leaf_node->next_leaf;
+
+		if (current_leaf == kNullNode)
+		{
+			return;
+		}
+
+		leaf_node = &leaf_nodes_[current_leaf];
+		position = 0;
+	}
+}
+
+template<typename T, size_t kNodeBytes>
+size_t BPlusTree<T, kNodeBytes>::GetHeight() const
+{
+	return height_;
+}
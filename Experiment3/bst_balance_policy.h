@@ -0,0 +1,122 @@
+#pragma once
+#include <algorithm>
+#include <utility>
+
+// ƽԣΪBinarySearchTreeģʹá
+// ÿṩ
+// kIsSelfBalancingǷҪڲ롢ɾز·ԵϵRebalance
+// NodeDataҪⱣݣ̳Ըͣ
+// Rebalance(node)nodeΪеnodeΪָָ룬ָµĸ
+
+// ƽԣͨĶ˳ʱ˻Ϊ
+class UnbalancedPolicy final
+{
+public:
+	static constexpr bool kIsSelfBalancing = false;
+
+	struct NodeData {};
+
+	template<typename TNodePtr>
+	static void Rebalance(TNodePtr&) {}
+};
+
+// AVLƽԣ֤߶Ȳ1
+// ߲1.44log2(n + 2)ұȽϴΪO(log n)
+class AVLBalancePolicy final
+{
+public:
+	static constexpr bool kIsSelfBalancing = true;
+
+	struct NodeData
+	{
+		// ԸýΪ߶ȣҶΪ1
+		int height = 1;
+	};
+
+	template<typename TNodePtr>
+	static void Rebalance(TNodePtr& node);
+
+private:
+	template<typename TNodePtr>
+	static int GetHeight(const TNodePtr& node)
+	{
+		return node ? node->height : 0;
+	}
+
+	template<typename TNodePtr>
+	static void UpdateHeight(TNodePtr& node)
+	{
+		node->height = 1 + std::max(GetHeight(node->left_child), GetHeight(node->right_child));
+	}
+
+	// nodeӳΪ¸
+	template<typename TNodePtr>
+	static void RotateRight(TNodePtr& node);
+
+	// nodeҺӳΪ¸
+	template<typename TNodePtr>
+	static void RotateLeft(TNodePtr& node);
+};
+
+template<typename TNodePtr>
+void AVLBalancePolicy::Rebalance(TNodePtr& node)
+{
+	if (!node)
+	{
+		return;
+	}
+
+	int balance_factor = GetHeight(node->left_child) - GetHeight(node->right_child);
+
+	// ߣLLֱLRȽ
+	if (balance_factor > 1)
+	{
+		if (GetHeight(node->left_child->left_child)
+			< GetHeight(node->left_child->right_child))
+		{
+			RotateLeft(node->left_child);
+		}
+
+		RotateRight(node);
+	}
+	// ߣRRֱRLȽ
+	else if (balance_factor < -1)
+	{
+		if (GetHeight(node->right_child->right_child)
+			< GetHeight(node->right_child->left_child))
+		{
+			RotateRight(node->right_child);
+		}
+
+		RotateLeft(node);
+	}
+	else
+	{
+		UpdateHeight(node);
+	}
+}
+
+// תֻƶָ룬κν
+template<typename TNodePtr>
+void AVLBalancePolicy::RotateRight(TNodePtr& node)
+{
+	TNodePtr new_root = std::move(node->left_child);
+	node->left_child = std::move(new_root->right_child);
+	UpdateHeight(node);
+
+	new_root->right_child = std::move(node);
+	node = std::move(new_root);
+	UpdateHeight(node);
+}
+
+template<typename TNodePtr>
+void AVLBalancePolicy::RotateLeft(TNodePtr& node)
+{
+	TNodePtr new_root = std::move(node->right_child);
+	node->right_child = std::move(new_root->left_child);
+	UpdateHeight(node);
+
+	new_root->left_child = std::move(node);
+	node = std::move(new_root);
+	UpdateHeight(node);
+}
@@ -4,18 +4,30 @@
 #include <vector>
 #include <stack>
 #include <utility>
+#include <array>
+#include <span>
+#include <algorithm>
+#include <ranges>
 //#include <iostream>
 
+#include "bst_balance_policy.h"
+#include "../Common/instrumentation.h"
+#include "../Common/prefetch.h"
+
 using std::shared_ptr;
 using std::make_shared;
 using std::vector;
 using std::stack;
 using std::pair;
+using std::array;
+using std::span;
 
-template<typename T>
+// TBalancePolicyΪƽԣbst_balance_policy.h
+// ĬUnbalancedPolicyͨʹAVLBalancePolicyʱ롢ɾز·Եϵ
+template<typename T, typename TBalancePolicy = UnbalancedPolicy>
 class BinarySearchTree final
 {
-	struct BSTNode
+	struct BSTNode : TBalancePolicy::NodeData
 	{
 		T value;
 		shared_ptr<BSTNode> left_child = nullptr;
@@ -43,6 +55,13 @@ class BinarySearchTree final
 
 	using BSTNodePtr = shared_ptr<BSTNode>;
 
+	// SearchBatchͬʱƽĲҸӦڴͬʱȴĻȱʧ
+	static constexpr size_t kBatchGroupSize = 16;
+
+	// BulkLoadһĽ顣н֮估root_ԿнָӵȨ
+	// ڵĿͳһͷţ֮ɾĿнClearʱͷ
+	vector<vector<BSTNode>> node_blocks_;
+
 	BSTNodePtr root_ = nullptr;
 
 	// Ԫصĵݹʵֺ
@@ -50,27 +69,56 @@ class BinarySearchTree final
 		const T& value, 
 		const BSTNodePtr& current_node, 
 		size_t& compare_count) const;
+	// Ԫصĵʵֺͬʱ·ϸǿսڸеָδsearch_path
+	BSTNodePtr& SearchPathImpl(
+		const T& value,
+		vector<BSTNodePtr*>& search_path,
+		size_t& compare_count) const;
 	// ɾԵǰΪĶڵ㲢ֵ
 	T DeleteLeftMostChildAndFetchValue(BSTNodePtr& current_node);
+	// target_nodeժָĽ㣬target_nodeǿա
+	// ýӣֵ滻ֵĽ׷ӵsearch_path
+	void UnlinkNode(BSTNodePtr& target_node, vector<BSTNodePtr*>& search_path);
+	// Եϵ·ϵĸ
+	static void RebalancePath(const vector<BSTNodePtr*>& search_path);
+	// ظsorted_values[begin, end)node_blockнƽ
+	static BSTNodePtr BuildBalancedSubtree(
+		const vector<T>& sorted_values,
+		size_t begin,
+		size_t end,
+		vector<BSTNode>& node_block);
 
 public:
 	BinarySearchTree() = default;
-	~BinarySearchTree() = default;
+	~BinarySearchTree();
+
+	// еĽ֮ԲӵȨָܸ
+	BinarySearchTree(const BinarySearchTree&) = delete;
+	BinarySearchTree& operator=(const BinarySearchTree&) = delete;
 
 	// ղ
 	void Clear();
+	// rangeеԪ滻ԭݡԪʱظԪֻһ
+	// һڴO(n)ȫƽĲұȽϴlog2(n) + 1
+	template<std::ranges::input_range TRange>
+	void BulkLoad(TRange&& range);
 	// Ԫ
 	void Insert(const T& value);
 	// Ԫ
 	pair<BSTNodePtr&, size_t> Search(const T& value) const;
+	// ңvaluesһһӦ{ָиԪصָ루ʱΪգ,ұȽϴ}
+	// ÿkBatchGroupSizeΪһ齻ƽÿƽһԤȡòҵһ㣬
+	// ʹڸҵĻȱʧ໥صȽϴSearchͬ
+	vector<pair<const T*, size_t>> SearchBatch(span<const T> values) const;
 	// ɾԪ
 	void Delete(const T& value);
 	// еУУ
 	vector<T> GetSortedList() const;
 };
 
-template<typename T>
-typename BinarySearchTree<T>::BSTNodePtr& BinarySearchTree<T>::SearchImpl(
+template<typename T, typename TBalancePolicy>
+typename BinarySearchTree<T, TBalancePolicy>::BSTNodePtr&
+BinarySearchTree<T, TBalancePolicy>::SearchImpl(
 	const T& value, 
 	const BSTNodePtr& current_node, 
 	size_t& compare_count) const
@@ -97,14 +145,48 @@ typename BinarySearchTree<T>::BSTNodePtr& BinarySearchTree<T>::SearchImpl(
 	}
 }
 
-template<typename T>
-T BinarySearchTree<T>::DeleteLeftMostChildAndFetchValue(
+template<typename T, typename TBalancePolicy>
+typename BinarySearchTree<T, TBalancePolicy>::BSTNodePtr&
+BinarySearchTree<T, TBalancePolicy>::SearchPathImpl(
+	const T& value,
+	vector<BSTNodePtr*>& search_path,
+	size_t& compare_count) const
+{
+	BSTNodePtr* current_node = const_cast<BSTNodePtr*>(&root_);
+
+	while (*current_node)
+	{
+		compare_count++;
+
+		if (value == (*current_node)->value)
+		{
+			break;
+		}
+
+		search_path.push_back(current_node);
+
+		if (value < (*current_node)->value)
+		{
+			current_node = &(*current_node)->left_child;
+		}
+		else
+		{
+			current_node = &(*current_node)->right_child;
+		}
+	}
+
+	return *current_node;
+}
+
+template<typename T, typename TBalancePolicy>
+T BinarySearchTree<T, TBalancePolicy>::DeleteLeftMostChildAndFetchValue(
 	BSTNodePtr& current_node)
 {
 	if (!current_node->left_child)
 	{
-		T value = current_node->value;
-		current_node = current_node->right_child;
+		T value = std::move(current_node->value);
+		// ƶǸҺӣɾʱɢе
+		current_node = std::move(current_node->right_child);
 		return value;
 	}
 	else
@@ -113,14 +195,160 @@ T BinarySearchTree<T>::DeleteLeftMostChildAndFetchValue(
 	}
 }
 
-template<typename T>
-void BinarySearchTree<T>::Clear()
+template<typename T, typename TBalancePolicy>
+void BinarySearchTree<T, TBalancePolicy>::UnlinkNode(
+	BSTNodePtr& target_node, vector<BSTNodePtr*>& search_path)
+{
+	// ͬDeleteLeftMostChildAndFetchValueָƶ
+	if (!target_node->left_child)
+	{
+		target_node = std::move(target_node->right_child);
+	}
+	else if (!target_node->right_child)
+	{
+		target_node = std::move(target_node->left_child);
+	}
+	else
+	{
+		search_path.push_back(&target_node);
+
+		BSTNodePtr* left_most_node = &target_node->right_child;
+
+		while ((*left_most_node)->left_child)
+		{
+			search_path.push_back(left_most_node);
+			left_most_node = &(*left_most_node)->left_child;
+		}
+
+		target_node->value = std::move((*left_most_node)->value);
+		*left_most_node = std::move((*left_most_node)->right_child);
+	}
+}
+
+template<typename T, typename TBalancePolicy>
+void BinarySearchTree<T, TBalancePolicy>::RebalancePath(
+	const vector<BSTNodePtr*>& search_path)
+{
+	// Եϵ²תֻı丸кָָ򣬲Ӱϲָĵַ
+	for (auto i = search_path.rbegin(); i != search_path.rend(); ++i)
+	{
+		TBalancePolicy::Rebalance(**i);
+	}
+}
+
+template<typename T, typename TBalancePolicy>
+auto BinarySearchTree<T, TBalancePolicy>::BuildBalancedSubtree(
+	const vector<T>& sorted_values,
+	size_t begin,
+	size_t end,
+	vector<BSTNode>& node_block)
+	->BSTNodePtr
+{
+	if (begin == end)
+	{
+		return nullptr;
+	}
+
+	// 㣬ڡݹΪlog2(n)
+	size_t middle = begin + (end - begin) / 2;
+	BSTNode& node = node_block.emplace_back(sorted_values[middle]);
+
+	node.left_child = BuildBalancedSubtree(sorted_values, begin, middle, node_block);
+	node.right_child = BuildBalancedSubtree(sorted_values, middle + 1, end, node_block);
+
+	// Կյ߹ָ룬ӵȨnode_blockͷ
+	BSTNodePtr node_ptr(BSTNodePtr(), &node);
+
+	// AVLȲԸ½ݣƽ⣬ת
+	TBalancePolicy::Rebalance(node_ptr);
+
+	return node_ptr;
+}
+
+template<typename T, typename TBalancePolicy>
+BinarySearchTree<T, TBalancePolicy>::~BinarySearchTree()
 {
+	Clear();
+}
+
+template<typename T, typename TBalancePolicy>
+void BinarySearchTree<T, TBalancePolicy>::Clear()
+{
+	// ȵժнĺָ룬ͳһͷţ
+	// ʹκνʱûкӣݹҲͷŵĽ
+	vector<BSTNodePtr> detached_nodes;
+
+	if (root_)
+	{
+		detached_nodes.push_back(std::move(root_));
+	}
+
+	for (size_t i = 0; i < detached_nodes.size(); i++)
+	{
+		BSTNode& node = *detached_nodes[i];
+
+		if (node.left_child)
+		{
+			detached_nodes.push_back(std::move(node.left_child));
+		}
+
+		if (node.right_child)
+		{
+			detached_nodes.push_back(std::move(node.right_child));
+		}
+	}
+
+	detached_nodes.clear();
+	node_blocks_.clear();
 	root_ = nullptr;
 }
 
-template<typename T>
-void BinarySearchTree<T>::Insert(const T& value)
+template<typename T, typename TBalancePolicy>
+template<std::ranges::input_range TRange>
+void BinarySearchTree<T, TBalancePolicy>::BulkLoad(TRange&& range)
+{
+	DSE_INSTRUMENT_SCOPE("BinarySearchTree::BulkLoad");
+
+	Clear();
+
+	vector<T> sorted_values;
+
+	if constexpr (std::ranges::sized_range<TRange>)
+	{
+		sorted_values.reserve(std::ranges::size(range));
+	}
+
+	for (const auto& value : range)
+	{
+		sorted_values.emplace_back(value);
+	}
+
+	// ʱֻO(n)
+	if (!std::is_sorted(sorted_values.begin(), sorted_values.end()))
+	{
+		std::sort(sorted_values.begin(), sorted_values.end());
+	}
+
+	sorted_values.erase(
+		std::unique(sorted_values.begin(), sorted_values.end()),
+		sorted_values.end());
+
+	if (sorted_values.empty())
+	{
+		return;
+	}
+
+	// Ԥȷȫ㣬нַ
+	vector<BSTNode>& node_block = node_blocks_.emplace_back();
+	node_block.reserve(sorted_values.size());
+
+	root_ = BuildBalancedSubtree(sorted_values, 0, sorted_values.size(), node_block);
+
+	DSE_INSTRUMENT_ADD(ALLOCATIONS, 1);
+}
+
+template<typename T, typename TBalancePolicy>
+void BinarySearchTree<T, TBalancePolicy>::Insert(const T& value)
 {
 	//// Ϊֱ½ڵ
 	//if (!root_)
@@ -160,48 +388,169 @@ void BinarySearchTree<T>::Insert(const T& value)
 	//	}
 	//}
 
-	// Searchʵ
-	BSTNodePtr& target_node = Search(value).first;
-	if (!target_node)
+	DSE_INSTRUMENT_SCOPE("BinarySearchTree::Insert");
+
+	if constexpr (!TBalancePolicy::kIsSelfBalancing)
 	{
-		target_node = make_shared<BSTNode>(value);
+		// Searchʵ
+		BSTNodePtr& target_node = Search(value).first;
+		if (!target_node)
+		{
+			target_node = make_shared<BSTNode>(value);
+			DSE_INSTRUMENT_ADD(ALLOCATIONS, 1);
+		}
+	}
+	else
+	{
+		// ƽʱҪ¼·ԱԵϵ
+		vector<BSTNodePtr*> search_path;
+		size_t compare_count = 0;
+
+		BSTNodePtr& target_node = SearchPathImpl(value, search_path, compare_count);
+
+		DSE_INSTRUMENT_ADD(COMPARES, compare_count);
+
+		if (!target_node)
+		{
+			target_node = make_shared<BSTNode>(value);
+			DSE_INSTRUMENT_ADD(ALLOCATIONS, 1);
+
+			RebalancePath(search_path);
+		}
 	}
 }
 
-template<typename T>
-auto BinarySearchTree<T>::Search(const T& value) const
-	->pair<typename BinarySearchTree<T>::BSTNodePtr&, size_t>
+template<typename T, typename TBalancePolicy>
+auto BinarySearchTree<T, TBalancePolicy>::Search(const T& value) const
+	->pair<typename BinarySearchTree<T, TBalancePolicy>::BSTNodePtr&, size_t>
 {
+	DSE_INSTRUMENT_SCOPE("BinarySearchTree::Search");
+
 	size_t compare_count = 0;
 	BSTNodePtr& search_result = SearchImpl(value, root_, compare_count);
+
+	// ÿαȽ϶Ӧ·ϵһ
+	DSE_INSTRUMENT_ADD(COMPARES, compare_count);
+	DSE_INSTRUMENT_ADD(NODES_VISITED, compare_count);
+	DSE_INSTRUMENT_PEAK(PEAK_DEPTH, compare_count);
+
 	return { search_result,compare_count };
 }
 
-template<typename T>
-void BinarySearchTree<T>::Delete(const T& value)
+template<typename T, typename TBalancePolicy>
+vector<pair<const T*, size_t>> BinarySearchTree<T, TBalancePolicy>::SearchBatch(
+	span<const T> values) const
 {
-	BSTNodePtr& target_node = Search(value).first;
+	DSE_INSTRUMENT_SCOPE("BinarySearchTree::SearchBatch");
 
-	if (target_node)
+	vector<pair<const T*, size_t>> search_results(values.size(), { nullptr,0 });
+
+	// ÿҵǰڵĽ㣬ҽΪ
+	array<const BSTNode*, kBatchGroupSize> current_nodes;
+
+	for (size_t group_begin = 0; group_begin < values.size(); group_begin += kBatchGroupSize)
 	{
-		if (!target_node->left_child)
+		const size_t group_size = std::min(kBatchGroupSize, values.size() - group_begin);
+		size_t active_count = root_ ? group_size : 0;
+
+		std::fill_n(current_nodes.begin(), group_size, root_.get());
+
+		while (active_count > 0)
 		{
-			target_node = target_node->right_child;
+			for (size_t i = 0; i < group_size; i++)
+			{
+				const BSTNode* current_node = current_nodes[i];
+
+				if (!current_node)
+				{
+					continue;
+				}
+
+				const T& value = values[group_begin + i];
+				auto& search_result = search_results[group_begin + i];
+
+				search_result.second++;
+
+				if (value == current_node->value)
+				{
+					search_result.first = &current_node->value;
+					current_node = nullptr;
+				}
+				else if (value < current_node->value)
+				{
+					current_node = current_node->left_child.get();
+				}
+				else
+				{
+					current_node = current_node->right_child.get();
+				}
+
+				// ֵò֮ǰҵķô˴Ԥȡص
+				if (current_node)
+				{
+					PrefetchForRead(current_node);
+				}
+				else
+				{
+					active_count--;
+				}
+
+				current_nodes[i] = current_node;
+			}
 		}
-		else if (!target_node->right_child)
+	}
+
+	// ÿαȽ϶Ӧ·ϵһ
+	for ([[maybe_unused]] const auto& search_result : search_results)
+	{
+		DSE_INSTRUMENT_ADD(COMPARES, search_result.second);
+		DSE_INSTRUMENT_ADD(NODES_VISITED, search_result.second);
+	}
+
+	return search_results;
+}
+
+template<typename T, typename TBalancePolicy>
+void BinarySearchTree<T, TBalancePolicy>::Delete(const T& value)
+{
+	if constexpr (!TBalancePolicy::kIsSelfBalancing)
+	{
+		BSTNodePtr& target_node = Search(value).first;
+
+		if (target_node)
 		{
-			target_node = target_node->right_child;
+			if (!target_node->left_child)
+			{
+				target_node = std::move(target_node->right_child);
+			}
+			else if (!target_node->right_child)
+			{
+				target_node = std::move(target_node->left_child);
+			}
+			else
+			{
+				target_node->value =
+					DeleteLeftMostChildAndFetchValue(target_node->right_child);
+			}
 		}
-		else
+	}
+	else
+	{
+		vector<BSTNodePtr*> search_path;
+		size_t compare_count = 0;
+
+		BSTNodePtr& target_node = SearchPathImpl(value, search_path, compare_count);
+
+		if (target_node)
 		{
-			target_node->value = 
-				DeleteLeftMostChildAndFetchValue(target_node->right_child);
+			UnlinkNode(target_node, search_path);
+			RebalancePath(search_path);
 		}
 	}
 }
 
-template<typename T>
-vector<T> BinarySearchTree<T>::GetSortedList() const
+template<typename T, typename TBalancePolicy>
+vector<T> BinarySearchTree<T, TBalancePolicy>::GetSortedList() const
 {
 	vector<T> sorted_list;
 
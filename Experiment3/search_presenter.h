@@ -8,8 +8,13 @@
 #include <algorithm>
 #include <string>
 #include <format>
+#include <limits>
+#include <span>
 
 #include "exp3bst.h"
+#include "bplus_tree.h"
+#include "sorted_array_index.h"
+#include "../Common/instrumentation.h"
 
 using std::cin;
 using std::cout;
@@ -23,6 +28,8 @@ using std::vector;
 using std::pair;
 using std::shuffle;
 using std::format;
+using std::numeric_limits;
+using std::span;
 
 template<typename T=int>
 class SearchPresenter final
@@ -30,11 +37,16 @@ class SearchPresenter final
 private:
 	// pimpl
 	unique_ptr<BinarySearchTree<T>> binary_search_tree_;
+	unique_ptr<BinarySearchTree<T, AVLBalancePolicy>> avl_tree_;
+	unique_ptr<BPlusTree<T>> bplus_tree_;
 
 	const string line_message_format_ = "{0:*^70s}";
 
-	// ۰㷨{ҽ±,ұȽϴ}
-	pair<int, size_t> BinarySearch(const vector<T>& data,const T& value) const;
+	// BinarySearchʧʱص±
+	static constexpr size_t kNotFound = numeric_limits<size_t>::max();
+
+	// ۰㷨{ҽ±꣨ʧʱΪkNotFound,ұȽϴ}
+	pair<size_t, size_t> BinarySearch(const vector<T>& data,const T& value) const;
 
 	using CompareCount = unsigned long long;
 
@@ -44,33 +56,68 @@ private:
 		CompareCount& total_failure_compare_count,
 		size_t& total_failure_count) const;
 
+	// 1~2048һsearch(value)ҳɹֱͳƱȽϴԽ
+	// search뷵{תΪboolĲҽ,ұȽϴ}
+	template<typename TSearchFunc>
+	void RunSearchTest(TSearchFunc&& search) const;
+
+	// 1~2048Ϊһsearch_batch(values)ҳɹֱͳƱȽϴԽ
+	// search_batch뷵valuesһһӦ{תΪboolĲҽ,ұȽϴ}
+	template<typename TSearchBatchFunc>
+	void RunBatchSearchTest(TSearchBatchFunc&& search_batch) const;
+
+	// dataβuse_bulk_loadΪtrueʱBulkLoadһ룩
+	// ٶ1~2048һҲԽԽղ
+	template<typename TSearchTree>
+	void TestSearchTree(
+		TSearchTree& search_tree,
+		const vector<int>& data,
+		const string& test_name,
+		bool use_bulk_load = false) const;
+
+	// sorted_listkLayoutֵٶ1~2048ҲԽ
+	// use_search_batchΪtrueʱSearchBatchһβȫԪأһ
+	template<SortedArrayLayout kLayout>
+	void TestSortedArrayIndex(
+		const vector<T>& sorted_list,
+		const string& test_name,
+		bool use_search_batch = false) const;
+
 public:
 	SearchPresenter() :
-		binary_search_tree_(make_unique<BinarySearchTree<T>>()){}
+		binary_search_tree_(make_unique<BinarySearchTree<T>>()),
+		avl_tree_(make_unique<BinarySearchTree<T, AVLBalancePolicy>>()),
+		bplus_tree_(make_unique<BPlusTree<T>>()){}
 	void BeginPresentation();
 };
 
 template<typename T>
-pair<int, size_t> SearchPresenter<T>::BinarySearch(
+pair<size_t, size_t> SearchPresenter<T>::BinarySearch(
 	const vector<T>& data, const T& value) const
 {
-	int low = 0, high = data.size() - 1;
+	DSE_INSTRUMENT_SCOPE("SearchPresenter::BinarySearch");
+
+	// ҷΧΪ[low, high)size_tʾ±꣬Ԫ2^31ʱҲ
+	size_t low = 0, high = data.size();
 
 	size_t compare_count = 0;
 
-	while (low <= high)
+	while (low < high)
 	{
-		int mid = (low + high) / 2;
+		// [low, high - 1]еͬҲ
+		size_t mid = low + (high - 1 - low) / 2;
 
 		compare_count++;
 
+		DSE_INSTRUMENT_ADD(COMPARES, 1);
+
 		if (value == data[mid])
 		{
 			return { mid,compare_count };
 		}
 		else if(value<data[mid])
 		{
-			high = mid - 1;
+			high = mid;
 		}
 		else
 		{
@@ -78,7 +125,7 @@ pair<int, size_t> SearchPresenter<T>::BinarySearch(
 		}
 	}
 
-	return{ -1,compare_count };
+	return{ kNotFound,compare_count };
 }
 
 template<typename T>
@@ -115,7 +162,6 @@ template<typename T>
 void SearchPresenter<T>::BeginPresentation()
 {
 	constexpr size_t kNumberCount = 1024;
-	const string kLongDashLine = string(25, '-');
 
 	vector<int> sorted_data(kNumberCount, 1);
 	vector<int> unsorted_data(kNumberCount, INT_MIN);
@@ -136,27 +182,112 @@ void SearchPresenter<T>::BeginPresentation()
 		<< endl << endl << endl;
 
 	// BST Sorted test
+	TestSearchTree(*binary_search_tree_, sorted_data, "BST, 1024 SORTED INTs");
+	binary_search_tree_->Clear();
+
+	// BST Random test
+	TestSearchTree(*binary_search_tree_, unsorted_data, "BST, 1024 RANDOM INTs");
+
+	auto bst_sorted_list = binary_search_tree_->GetSortedList();
+
+	binary_search_tree_->Clear();
+
+	// BST Bulk Load test
+	// ٽȫƽĲ
+	TestSearchTree(*binary_search_tree_, unsorted_data, "BST BULK LOAD, 1024 RANDOM INTs", true);
+	binary_search_tree_->Clear();
+
+	// AVL Sorted test
+	TestSearchTree(*avl_tree_, sorted_data, "AVL, 1024 SORTED INTs");
+	avl_tree_->Clear();
+
+	// AVL Random test
+	TestSearchTree(*avl_tree_, unsorted_data, "AVL, 1024 RANDOM INTs");
+
+	// AVL Batch Search test
+	// ͬһңȽϴӦһͬ
+	cout
+		<< format(line_message_format_, " TEST BEGINS : AVL BATCH SEARCH, 1024 RANDOM INTs ")
+		<< endl;
+
+	RunBatchSearchTest([&](span<const T> values)
+		{
+			return avl_tree_->SearchBatch(values);
+		});
+
+	avl_tree_->Clear();
+
+	// B+ Tree Sorted test
+	// B+ıȽϴȫؼ֣Զڶÿβֻ߸
+	TestSearchTree(*bplus_tree_, sorted_data, "B+ TREE, 1024 SORTED INTs");
+	bplus_tree_->Clear();
+
+	// B+ Tree Random test
+	TestSearchTree(*bplus_tree_, unsorted_data, "B+ TREE, 1024 RANDOM INTs");
+	bplus_tree_->Clear();
+
+	// Binary Search Test
 	cout 
-		<< format(line_message_format_, " TEST BEGINS : BST, 1024 SORTED INTs ")
+		<< format(line_message_format_,
+			" TEST BEGINS : BINARY SEARCH, 1024 SORTED INTs ")
 		<< endl;
-	cout << kLongDashLine << endl << "Inserting test data..." << endl;
 
-	for (int i : sorted_data)
-	{
-		binary_search_tree_->Insert(i);
-	}
+	RunSearchTest([&](const T& value)
+		{
+			auto search_results = BinarySearch(bst_sorted_list, value);
+			return pair{ search_results.first != kNotFound,search_results.second };
+		});
+
+	// Sorted Array Index tests
+	// ֲ־GetSortedListĽ
+	TestSortedArrayIndex<SortedArrayLayout::SORTED>(
+		bst_sorted_list, "BRANCHLESS BINARY SEARCH, 1024 SORTED INTs");
+	TestSortedArrayIndex<SortedArrayLayout::EYTZINGER>(
+		bst_sorted_list, "EYTZINGER SEARCH, 1024 SORTED INTs");
+	TestSortedArrayIndex<SortedArrayLayout::EYTZINGER>(
+		bst_sorted_list, "EYTZINGER BATCH SEARCH, 1024 SORTED INTs", true);
+	TestSortedArrayIndex<SortedArrayLayout::K_ARY>(
+		bst_sorted_list, "K-ARY SEARCH, 1024 SORTED INTs");
+}
 
-	cout << "Successful." << endl << kLongDashLine << endl;
+template<typename T>
+template<typename TSearchFunc>
+void SearchPresenter<T>::RunSearchTest(TSearchFunc&& search) const
+{
+	RunBatchSearchTest([&](span<const T> values)
+		{
+			vector<pair<bool, size_t>> search_results;
+			search_results.reserve(values.size());
+
+			for (const T& value : values)
+			{
+				auto search_result = search(value);
+				search_results.emplace_back(
+					static_cast<bool>(search_result.first), search_result.second);
+			}
+
+			return search_results;
+		});
+}
 
+template<typename T>
+template<typename TSearchBatchFunc>
+void SearchPresenter<T>::RunBatchSearchTest(TSearchBatchFunc&& search_batch) const
+{
 	CompareCount total_successful_compare_count = 0;
 	size_t total_successful_count = 0;
 	CompareCount total_failure_compare_count = 0;
 	size_t total_failure_count = 0;
 
+	vector<T> values;
+
 	for (int i = 1; i <= 2048; i++)
 	{
-		auto search_results = binary_search_tree_->Search(i);
+		values.push_back(i);
+	}
 
+	for (const auto& search_results : search_batch(span<const T>(values)))
+	{
 		if (search_results.first)
 		{
 			total_successful_compare_count += search_results.second;
@@ -173,71 +304,77 @@ void SearchPresenter<T>::BeginPresentation()
 		total_successful_count,
 		total_failure_compare_count,
 		total_failure_count);
+}
 
-	binary_search_tree_->Clear();
+template<typename T>
+template<typename TSearchTree>
+void SearchPresenter<T>::TestSearchTree(
+	TSearchTree& search_tree,
+	const vector<int>& data,
+	const string& test_name,
+	bool use_bulk_load) const
+{
+	const string kLongDashLine = string(25, '-');
 
-	// BST Random test
-	cout 
-		<< format(line_message_format_," TEST BEGINS : BST, 1024 RANDOM INTs ") 
+	cout
+		<< format(line_message_format_, format(" TEST BEGINS : {0} ", test_name))
 		<< endl;
 	cout << kLongDashLine << endl << "Inserting test data..." << endl;
 
-	for (int i : unsorted_data)
-	{
-		binary_search_tree_->Insert(i);
-	}
-
-	cout << "Successful." << endl << kLongDashLine << endl;
+	bool is_bulk_loaded = false;
 
-	for (int i = 1; i <= 2048; i++)
+	// ֻṩBulkLoadĲ
+	if constexpr (requires { search_tree.BulkLoad(data); })
 	{
-		auto search_results = binary_search_tree_->Search(i);
-
-		if (search_results.first)
+		if (use_bulk_load)
 		{
-			total_successful_compare_count += search_results.second;
-			total_successful_count++;
+			search_tree.BulkLoad(data);
+			is_bulk_loaded = true;
 		}
-		else
+	}
+
+	if (!is_bulk_loaded)
+	{
+		for (int i : data)
 		{
-			total_failure_compare_count += search_results.second;
-			total_failure_count++;
+			search_tree.Insert(i);
 		}
 	}
 
-	PrintAndClearTestResults(total_successful_compare_count,
-		total_successful_count,
-		total_failure_compare_count,
-		total_failure_count);
-
-	auto bst_sorted_list = binary_search_tree_->GetSortedList();
+	cout << "Successful." << endl << kLongDashLine << endl;
 
-	binary_search_tree_->Clear();
+	RunSearchTest([&](const T& value)
+		{
+			return search_tree.Search(value);
+		});
+}
 
-	// Binary Search Test
-	cout 
-		<< format(line_message_format_,
-			" TEST BEGINS : BINARY SEARCH, 1024 SORTED INTs ")
+template<typename T>
+template<SortedArrayLayout kLayout>
+void SearchPresenter<T>::TestSortedArrayIndex(
+	const vector<T>& sorted_list,
+	const string& test_name,
+	bool use_search_batch) const
+{
+	cout
+		<< format(line_message_format_, format(" TEST BEGINS : {0} ", test_name))
 		<< endl;
 
-	for (int i = 1; i <= 2048; i++)
-	{
-		auto search_results = BinarySearch(bst_sorted_list, i);
+	SortedArrayIndex<T, kLayout> sorted_array_index;
+	sorted_array_index.Build(sorted_list);
 
-		if (search_results.first!=-1)
-		{
-			total_successful_compare_count += search_results.second;
-			total_successful_count++;
-		}
-		else
-		{
-			total_failure_compare_count += search_results.second;
-			total_failure_count++;
-		}
+	if (use_search_batch)
+	{
+		RunBatchSearchTest([&](span<const T> values)
+			{
+				return sorted_array_index.SearchBatch(values);
+			});
+	}
+	else
+	{
+		RunSearchTest([&](const T& value)
+			{
+				return sorted_array_index.Search(value);
+			});
 	}
-
-	PrintAndClearTestResults(total_successful_compare_count,
-		total_successful_count,
-		total_failure_compare_count,
-		total_failure_count);
 }
@@ -0,0 +1,480 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "../Common/instrumentation.h"
+#include "../Common/prefetch.h"
+
+using std::array;
+using std::pair;
+using std::span;
+using std::vector;
+
+// Ĵ洢
+enum class SortedArrayLayout
+{
+	// ԭ飬ʹ޷֧۰ңԤȡһֵѡλ
+	SORTED,
+	// Eytzinger֣ŵȫkĺΪ2k2k + 1
+	// ͬһдڵɸʱԤȡ֮ĺ
+	EYTZINGER,
+	// k֣S-treeÿռһУkKAryNodeKeysؼ֣kKAryNodeKeys + 1ӣ
+	// һαȽȫؼ֣ԼΪlog(n) / log(kKAryNodeKeys + 1)
+	K_ARY
+};
+
+// ̬УGetSortedListĽһԹֻ
+// ģkLayout洢֣SortedArrayLayout
+// ±볤ȾΪsize_tԪɳ2^31
+// ڱȽڱʱAVX2MSVC/arch:AVX2GCC/Clang-mavx2TΪintʱʹAVX2ָ
+// ʹ޷֧ıѭɱԶ
+template<typename T, SortedArrayLayout kLayout = SortedArrayLayout::EYTZINGER>
+class SortedArrayIndex final
+{
+private:
+	static constexpr size_t kCacheLineSize = 64;
+	// һеԪظ
+	static constexpr size_t kElementsPerCacheLine =
+		kCacheLineSize / sizeof(T) > 1 ? kCacheLineSize / sizeof(T) : 1;
+	static constexpr size_t kKAryNodeKeys =
+		kElementsPerCacheLine > 2 ? kElementsPerCacheLine : 2;
+	// SearchBatchͬʱƽĲҸӦڴͬʱȴĻȱʧ
+	static constexpr size_t kBatchGroupSize = 16;
+
+	struct alignas(kCacheLineSize) KAryNode
+	{
+		T keys[kKAryNodeKeys];
+	};
+
+	// SORTEDΪ飻EYTZINGERkeys_[1, size_]Ϊн㣬keys_[0]ʹ
+	vector<T> keys_;
+	// K_ARYµĽ㣬һвĹؼԪ
+	vector<KAryNode> k_ary_nodes_;
+
+	size_t size_ = 0;
+
+	// ˳kΪEytzinger
+	void BuildEytzinger(const vector<T>& sorted_list, size_t& sorted_position, size_t k);
+	// ˳kΪkþԪ
+	void BuildKAry(const vector<T>& sorted_list, size_t& sorted_position, size_t k);
+
+	// ̬ԱCountKeysBelowkСvalueĹؼָ
+	static size_t CountKeysBelow(const KAryNode& node, const T& value);
+
+	// زСvalueСԪصָ룬ʱؿָ룬ұȽϴۼӵcompare_count
+	const T* LowerBoundImpl(const T& value, size_t& compare_count) const;
+	// valuesеһ飨kBatchGroupSizeҽִLowerBoundImpl
+	// дlower_boundscompare_counts
+	void LowerBoundGroup(
+		const T* values,
+		size_t group_size,
+		const T** lower_bounds,
+		size_t* compare_counts) const;
+
+public:
+	SortedArrayIndex() = default;
+	~SortedArrayIndex() = default;
+
+	// sorted_listԭݱ滻
+	void Build(const vector<T>& sorted_list);
+	// 
+	void Clear();
+	// زСvalueСԪصָ룬ʱؿָ
+	const T* LowerBound(const T& value) const;
+	// Ԫأ{ָԪصָ루ʱΪգ,ұȽϴ}
+	pair<const T*, size_t> Search(const T& value) const;
+	// ңvaluesһһӦ{ָԪصָ루ʱΪգ,ұȽϴ}
+	// ÿkBatchGroupSizeΪһ飬ڸ㽻ƽÿƽһԤȡòһʵλã
+	// ʹڸҵĻȱʧ໥صȽϴSearchͬ
+	vector<pair<const T*, size_t>> SearchBatch(span<const T> values) const;
+	// Ԫظ
+	size_t GetSize() const;
+};
+
+template<typename T, SortedArrayLayout kLayout>
+void SortedArrayIndex<T, kLayout>::BuildEytzinger(
+	const vector<T>& sorted_list, size_t& sorted_position, size_t k)
+{
+	// ݹΪߣlog2(n)
+	if (k > size_)
+	{
+		return;
+	}
+
+	BuildEytzinger(sorted_list, sorted_position, 2 * k);
+	keys_[k] = sorted_list[sorted_position++];
+	BuildEytzinger(sorted_list, sorted_position, 2 * k + 1);
+}
+
+template<typename T, SortedArrayLayout kLayout>
+void SortedArrayIndex<T, kLayout>::BuildKAry(
+	const vector<T>& sorted_list, size_t& sorted_position, size_t k)
+{
+	if (k >= k_ary_nodes_.size())
+	{
+		return;
+	}
+
+	// kĵiΪk * (kKAryNodeKeys + 1) + i + 1
+	for (size_t i = 0; i < kKAryNodeKeys; i++)
+	{
+		BuildKAry(sorted_list, sorted_position, k * (kKAryNodeKeys + 1) + i + 1);
+
+		k_ary_nodes_[k].keys[i] = sorted_position < size_
+			? sorted_list[sorted_position++]
+			: sorted_list.back();
+	}
+
+	BuildKAry(sorted_list, sorted_position, k * (kKAryNodeKeys + 1) + kKAryNodeKeys + 1);
+}
+
+template<typename T, SortedArrayLayout kLayout>
+size_t SortedArrayIndex<T, kLayout>::CountKeysBelow(const KAryNode& node, const T& value)
+{
+#ifdef __AVX2__
+	if constexpr (std::is_same_v<T, int>)
+	{
+		const __m256i value_vector = _mm256_set1_epi32(value);
+		size_t count = 0;
+
+		for (size_t i = 0; i < kKAryNodeKeys; i += 8)
+		{
+			__m256i key_vector =
+				_mm256_load_si256(reinterpret_cast<const __m256i*>(node.keys + i));
+
+			count += std::popcount(static_cast<unsigned>(_mm256_movemask_ps(
+				_mm256_castsi256_ps(_mm256_cmpgt_epi32(value_vector, key_vector)))));
+		}
+
+		return count;
+	}
+#endif
+
+	size_t count = 0;
+
+	for (size_t i = 0; i < kKAryNodeKeys; i++)
+	{
+		count += node.keys[i] < value;
+	}
+
+	return count;
+}
+
+template<typename T, SortedArrayLayout kLayout>
+const T* SortedArrayIndex<T, kLayout>::LowerBoundImpl(
+	const T& value, size_t& compare_count) const
+{
+	if (size_ == 0)
+	{
+		return nullptr;
+	}
+
+	if constexpr (kLayout == SortedArrayLayout::SORTED)
+	{
+		// ÿֽΧСһ룬ʹ֧ѭֻȡԪظ
+		const T* base = keys_.data();
+		size_t length = size_;
+
+		while (length > 1)
+		{
+			size_t half = length / 2;
+			size_t next_half = (length - half) / 2;
+
+			// һֱȽϵλֻ֮һ
+			PrefetchForRead(base + next_half);
+			PrefetchForRead(base + half + next_half);
+
+			compare_count++;
+			base = base[half] < value ? base + half : base;
+			length -= half;
+		}
+
+		compare_count++;
+		base += *base < value;
+
+		return base == keys_.data() + size_ ? nullptr : base;
+	}
+	else if constexpr (kLayout == SortedArrayLayout::EYTZINGER)
+	{
+		const T* keys = keys_.data();
+		size_t k = 1;
+
+		while (k <= size_)
+		{
+			// k֮log2(kElementsPerCacheLine)ĺţԤȡڻ
+			PrefetchForRead(keys + std::min(k * kElementsPerCacheLine, size_));
+
+			compare_count++;
+			k = 2 * k + (keys[k] < value);
+		}
+
+		// ȥĩβ1󼸴ңǰһ0õһĽ㣬СvalueСԪ
+		k >>= std::countr_one(k) + 1;
+
+		return k == 0 ? nullptr : keys + k;
+	}
+	else
+	{
+		const size_t node_count = k_ary_nodes_.size();
+		const T* result = nullptr;
+		size_t k = 0;
+
+		while (k < node_count)
+		{
+			const KAryNode& node = k_ary_nodes_[k];
+			size_t position = CountKeysBelow(node, value);
+
+			compare_count += kKAryNodeKeys;
+			result = position < kKAryNodeKeys ? node.keys + position : result;
+			k = k * (kKAryNodeKeys + 1) + position + 1;
+		}
+
+		return result;
+	}
+}
+
+template<typename T, SortedArrayLayout kLayout>
+void SortedArrayIndex<T, kLayout>::LowerBoundGroup(
+	const T* values,
+	size_t group_size,
+	const T** lower_bounds,
+	size_t* compare_counts) const
+{
+	if (size_ == 0)
+	{
+		std::fill_n(lower_bounds, group_size, nullptr);
+		return;
+	}
+
+	if constexpr (kLayout == SortedArrayLayout::SORTED)
+	{
+		// ѭֻȡԪظڸͬƽ
+		array<const T*, kBatchGroupSize> bases;
+		std::fill_n(bases.begin(), group_size, keys_.data());
+
+		size_t length = size_;
+
+		while (length > 1)
+		{
+			size_t half = length / 2;
+			size_t next_half = (length - half) / 2;
+
+			for (size_t i = 0; i < group_size; i++)
+			{
+				bases[i] = bases[i][half] < values[i] ? bases[i] + half : bases[i];
+				PrefetchForRead(bases[i] + next_half);
+				compare_counts[i]++;
+			}
+
+			length -= half;
+		}
+
+		for (size_t i = 0; i < group_size; i++)
+		{
+			const T* base = bases[i] + (*bases[i] < values[i]);
+
+			compare_counts[i]++;
+			lower_bounds[i] = base == keys_.data() + size_ ? nullptr : base;
+		}
+	}
+	else if constexpr (kLayout == SortedArrayLayout::EYTZINGER)
+	{
+		const T* keys = keys_.data();
+
+		array<size_t, kBatchGroupSize> ks;
+		std::fill_n(ks.begin(), group_size, 1);
+
+		// ҵĲһ
+		bool has_active_search = true;
+
+		while (has_active_search)
+		{
+			has_active_search = false;
+
+			for (size_t i = 0; i < group_size; i++)
+			{
+				size_t k = ks[i];
+
+				if (k <= size_)
+				{
+					k = 2 * k + (keys[k] < values[i]);
+					PrefetchForRead(keys + std::min(k, size_));
+					compare_counts[i]++;
+
+					ks[i] = k;
+					has_active_search = has_active_search || k <= size_;
+				}
+			}
+		}
+
+		for (size_t i = 0; i < group_size; i++)
+		{
+			size_t k = ks[i] >> (std::countr_one(ks[i]) + 1);
+			lower_bounds[i] = k == 0 ? nullptr : keys + k;
+		}
+	}
+	else
+	{
+		const size_t node_count = k_ary_nodes_.size();
+
+		array<size_t, kBatchGroupSize> ks;
+		std::fill_n(ks.begin(), group_size, 0);
+		std::fill_n(lower_bounds, group_size, nullptr);
+
+		bool has_active_search = true;
+
+		while (has_active_search)
+		{
+			has_active_search = false;
+
+			for (size_t i = 0; i < group_size; i++)
+			{
+				size_t k = ks[i];
+
+				if (k < node_count)
+				{
+					const KAryNode& node = k_ary_nodes_[k];
+					size_t position = CountKeysBelow(node, values[i]);
+
+					compare_counts[i] += kKAryNodeKeys;
+					lower_bounds[i] =
+						position < kKAryNodeKeys ? node.keys + position : lower_bounds[i];
+
+					k = k * (kKAryNodeKeys + 1) + position + 1;
+					PrefetchForRead(&k_ary_nodes_[std::min(k, node_count - 1)]);
+
+					ks[i] = k;
+					has_active_search = has_active_search || k < node_count;
+				}
+			}
+		}
+	}
+}
+
+template<typename T, SortedArrayLayout kLayout>
+void SortedArrayIndex<T, kLayout>::Build(const vector<T>& sorted_list)
+{
+	Clear();
+
+	size_ = sorted_list.size();
+
+	if (size_ == 0)
+	{
+		return;
+	}
+
+	size_t sorted_position = 0;
+
+	if constexpr (kLayout == SortedArrayLayout::SORTED)
+	{
+		keys_ = sorted_list;
+	}
+	else if constexpr (kLayout == SortedArrayLayout::EYTZINGER)
+	{
+		keys_.resize(size_ + 1);
+		BuildEytzinger(sorted_list, sorted_position, 1);
+	}
+	else
+	{
+		k_ary_nodes_.resize((size_ + kKAryNodeKeys - 1) / kKAryNodeKeys);
+		BuildKAry(sorted_list, sorted_position, 0);
+	}
+}
+
+template<typename T, SortedArrayLayout kLayout>
+void SortedArrayIndex<T, kLayout>::Clear()
+{
+	keys_.clear();
+	k_ary_nodes_.clear();
+	size_ = 0;
+}
+
+template<typename T, SortedArrayLayout kLayout>
+const T* SortedArrayIndex<T, kLayout>::LowerBound(const T& value) const
+{
+	size_t compare_count = 0;
+	return LowerBoundImpl(value, compare_count);
+}
+
+template<typename T, SortedArrayLayout kLayout>
+pair<const T*, size_t> SortedArrayIndex<T, kLayout>::Search(const T& value) const
+{
+	DSE_INSTRUMENT_SCOPE("SortedArrayIndex::Search");
+
+	size_t compare_count = 0;
+	const T* lower_bound = LowerBoundImpl(value, compare_count);
+
+	const T* search_result = nullptr;
+
+	if (lower_bound)
+	{
+		compare_count++;
+
+		if (*lower_bound == value)
+		{
+			search_result = lower_bound;
+		}
+	}
+
+	DSE_INSTRUMENT_ADD(COMPARES, compare_count);
+
+	return { search_result,compare_count };
+}
+
+template<typename T, SortedArrayLayout kLayout>
+vector<pair<const T*, size_t>> SortedArrayIndex<T, kLayout>::SearchBatch(
+	span<const T> values) const
+{
+	DSE_INSTRUMENT_SCOPE("SortedArrayIndex::SearchBatch");
+
+	vector<pair<const T*, size_t>> search_results(values.size(), { nullptr,0 });
+
+	array<const T*, kBatchGroupSize> lower_bounds;
+	array<size_t, kBatchGroupSize> compare_counts;
+
+	for (size_t group_begin = 0; group_begin < values.size(); group_begin += kBatchGroupSize)
+	{
+		const size_t group_size = std::min(kBatchGroupSize, values.size() - group_begin);
+
+		std::fill_n(compare_counts.begin(), group_size, 0);
+		LowerBoundGroup(values.data() + group_begin,
+			group_size,
+			lower_bounds.data(),
+			compare_counts.data());
+
+		for (size_t i = 0; i < group_size; i++)
+		{
+			auto& search_result = search_results[group_begin + i];
+			search_result.second = compare_counts[i];
+
+			if (lower_bounds[i])
+			{
+				search_result.second++;
+
+				if (*lower_bounds[i] == values[group_begin + i])
+				{
+					search_result.first = lower_bounds[i];
+				}
+			}
+
+			DSE_INSTRUMENT_ADD(COMPARES, search_result.second);
+		}
+	}
+
+	return search_results;
+}
+
+template<typename T, SortedArrayLayout kLayout>
+size_t SortedArrayIndex<T, kLayout>::GetSize() const
+{
+	return size_;
+}